@@ -0,0 +1,108 @@
+#ifndef E_REGEX_ANALYSIS_ANCHORS_HPP_
+#define E_REGEX_ANALYSIS_ANCHORS_HPP_
+
+#include <tuple>
+
+#include "node_traits.hpp"
+
+namespace e_regex::analysis
+{
+    namespace __private
+    {
+        template<typename node>
+        constexpr auto starts_with_anchor() noexcept -> bool;
+
+        template<typename children>
+        struct all_start_with_anchor;
+
+        template<typename... children>
+        struct all_start_with_anchor<std::tuple<children...>>
+        {
+                static constexpr bool value
+                    = sizeof...(children) > 0
+                      && (starts_with_anchor<children>() && ...);
+        };
+
+        template<typename node>
+        constexpr auto starts_with_anchor() noexcept -> bool
+        {
+            using traits = node_traits<node>;
+
+            if constexpr (traits::kind == node_kind::start_anchor)
+            {
+                return true;
+            }
+            else if constexpr (traits::kind == node_kind::alternation)
+            {
+                return all_start_with_anchor<
+                    typename traits::children>::value;
+            }
+            else if constexpr (traits::kind == node_kind::repetition)
+            {
+                return traits::minimum > 0
+                       && starts_with_anchor<typename traits::head>();
+            }
+            else if constexpr (traits::kind == node_kind::sequence
+                               || traits::kind == node_kind::group)
+            {
+                return starts_with_anchor<typename traits::head>();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        template<typename node>
+        constexpr auto has_anchor() noexcept -> bool;
+
+        template<typename... children>
+        constexpr auto has_anchor(std::tuple<children...>*) noexcept -> bool
+        {
+            return (has_anchor<children>() || ...);
+        }
+
+        template<typename node>
+        constexpr auto has_anchor() noexcept -> bool
+        {
+            using traits = node_traits<node>;
+
+            if constexpr (traits::kind == node_kind::start_anchor
+                          || traits::kind == node_kind::end_anchor)
+            {
+                return true;
+            }
+            else if constexpr (traits::kind == node_kind::bytes
+                               || traits::kind == node_kind::literal)
+            {
+                return false;
+            }
+            else if constexpr (traits::kind == node_kind::alternation)
+            {
+                return has_anchor(
+                    static_cast<typename traits::children*>(nullptr));
+            }
+            else
+            {
+                return has_anchor<typename traits::head>()
+                       || has_anchor(
+                           static_cast<typename traits::children*>(nullptr));
+            }
+        }
+    } // namespace __private
+
+    /**
+     * @brief True if node contains ^ or $ anywhere
+     */
+    template<typename node>
+    inline constexpr bool has_anchor = __private::has_anchor<node>();
+
+    /**
+     * @brief True if every match of node must begin with ^
+     */
+    template<typename node>
+    inline constexpr bool starts_with_anchor
+        = __private::starts_with_anchor<node>();
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_ANCHORS_HPP_*/
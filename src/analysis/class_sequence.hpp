@@ -0,0 +1,181 @@
+#ifndef E_REGEX_ANALYSIS_CLASS_SEQUENCE_HPP_
+#define E_REGEX_ANALYSIS_CLASS_SEQUENCE_HPP_
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <tuple>
+
+#include "node_traits.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::analysis
+{
+    // Longest sequence tracked by the analysis, a bit per position
+    inline constexpr auto max_class_sequence = 64U;
+
+    // Sequence of byte sets, each consuming one byte, some optional
+    struct class_sequence
+    {
+            std::array<byte_set, max_class_sequence> bytes = {};
+
+            // Bit i is set if position i can be skipped
+            std::uint64_t optional = 0;
+
+            unsigned size = 0;
+
+            // False if node is not such a sequence
+            bool valid = true;
+
+            constexpr void push(const byte_set& set, bool skippable) noexcept
+            {
+                if (!valid || size == max_class_sequence)
+                {
+                    valid = false;
+                    return;
+                }
+
+                bytes[size] = set;
+                optional |= skippable ? std::uint64_t {1} << size : 0;
+                ++size;
+            }
+
+            constexpr auto minimum() const noexcept -> unsigned
+            {
+                return size - std::popcount(optional);
+            }
+    };
+
+    namespace __private
+    {
+        template<typename node>
+        constexpr void sequence_of(class_sequence& result) noexcept;
+
+        template<typename... children>
+        constexpr void sequence_of_children(class_sequence& result,
+                                            std::tuple<children...>*) noexcept
+        {
+            if constexpr (sizeof...(children) == 1)
+            {
+                (sequence_of<children>(result), ...);
+            }
+            else if constexpr (sizeof...(children) > 1)
+            {
+                // Branches of one position each, e.g. [ab], are one
+                // position admitting all of them
+                byte_set bytes;
+
+                const auto single = [&bytes]<typename child>(child*) {
+                    class_sequence branch;
+                    sequence_of<child>(branch);
+                    bytes = bytes | branch.bytes[0];
+
+                    return branch.valid && branch.size == 1
+                           && branch.optional == 0;
+                };
+
+                if ((single(static_cast<children*>(nullptr)) && ...))
+                {
+                    result.push(bytes, false);
+                }
+                else
+                {
+                    result.valid = false;
+                }
+            }
+        }
+
+        template<typename node>
+        constexpr void sequence_of(class_sequence& result) noexcept
+        {
+            using traits = node_traits<node>;
+
+            if constexpr (traits::kind == node_kind::bytes)
+            {
+                result.push(traits::bytes, false);
+            }
+            else if constexpr (traits::kind == node_kind::literal)
+            {
+                for (const auto c: traits::literal)
+                {
+                    byte_set bytes;
+                    bytes.insert(static_cast<unsigned char>(c));
+
+                    result.push(bytes, false);
+                }
+            }
+            else if constexpr (traits::kind == node_kind::alternation)
+            {
+                sequence_of_children(
+                    result, static_cast<typename traits::children*>(nullptr));
+            }
+            else if constexpr (traits::kind == node_kind::sequence
+                               || traits::kind == node_kind::group)
+            {
+                sequence_of<typename traits::head>(result);
+                sequence_of_children(
+                    result, static_cast<typename traits::children*>(nullptr));
+            }
+            else if constexpr (traits::kind == node_kind::repetition)
+            {
+                if constexpr (traits::maximum == unbounded)
+                {
+                    result.valid = false;
+                    return;
+                }
+
+                for (unsigned i = 0; i < traits::minimum && result.valid; ++i)
+                {
+                    sequence_of<typename traits::head>(result);
+                }
+
+                if constexpr (traits::maximum > traits::minimum)
+                {
+                    // Only single positions can be skipped one by one
+                    class_sequence head;
+                    sequence_of<typename traits::head>(head);
+
+                    if (!head.valid || head.size != 1 || head.optional != 0)
+                    {
+                        result.valid = false;
+                    }
+
+                    for (auto i = traits::minimum;
+                         i < traits::maximum && result.valid;
+                         ++i)
+                    {
+                        result.push(head.bytes[0], true);
+                    }
+                }
+
+                sequence_of_children(
+                    result, static_cast<typename traits::children*>(nullptr));
+            }
+            else
+            {
+                // Anchors
+                result.valid = false;
+            }
+        }
+
+        template<typename node>
+        constexpr auto make_class_sequence() noexcept -> class_sequence
+        {
+            class_sequence result;
+            sequence_of<node>(result);
+
+            return result;
+        }
+    } // namespace __private
+
+    /**
+     * @brief node as a sequence of at most max_class_sequence byte
+     * sets, where counted repetitions are unrolled and the copies
+     * above their minimum are optional
+     */
+    template<typename node>
+    inline constexpr auto class_sequence_v
+        = __private::make_class_sequence<node>();
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_CLASS_SEQUENCE_HPP_*/
@@ -0,0 +1,138 @@
+#ifndef E_REGEX_ANALYSIS_LEADING_LITERALS_HPP_
+#define E_REGEX_ANALYSIS_LEADING_LITERALS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+#include "literal.hpp"
+#include "node_traits.hpp"
+
+namespace e_regex::analysis
+{
+    // Largest set of leading literals tracked by the analysis
+    inline constexpr auto max_leading_literals = 16U;
+
+    // Literals one of which starts every match
+    struct literal_set
+    {
+            std::array<literal, max_leading_literals> literals = {};
+            unsigned                                  size     = 0;
+
+            // False if no such set is known
+            bool valid = true;
+
+            constexpr auto operator|(const literal_set& other) const noexcept
+                -> literal_set
+            {
+                auto result  = *this;
+                result.valid = valid && other.valid;
+
+                for (unsigned i = 0; i < other.size && result.valid; ++i)
+                {
+                    const auto* known = std::find(result.literals.begin(),
+                                                  result.literals.begin()
+                                                      + result.size,
+                                                  other.literals[i]);
+
+                    if (known != result.literals.begin() + result.size)
+                    {
+                        continue;
+                    }
+
+                    if (result.size == max_leading_literals)
+                    {
+                        result.valid = false;
+                    }
+                    else
+                    {
+                        result.literals[result.size++] = other.literals[i];
+                    }
+                }
+
+                return result;
+            }
+
+            constexpr auto shortest() const noexcept -> unsigned
+            {
+                unsigned result = size == 0 ? 0 : max_literal_size;
+
+                for (unsigned i = 0; i < size; ++i)
+                {
+                    result = std::min(result, literals[i].size);
+                }
+
+                return result;
+            }
+    };
+
+    namespace __private
+    {
+        template<typename node>
+        constexpr auto leading() noexcept -> literal_set;
+
+        template<typename... children>
+        constexpr auto leading_alternation(std::tuple<children...>*) noexcept
+            -> literal_set
+        {
+            if constexpr (sizeof...(children) == 0)
+            {
+                return literal_set {.valid = false};
+            }
+            else
+            {
+                return (literal_set {} | ... | leading<children>());
+            }
+        }
+
+        template<typename node>
+        constexpr auto leading() noexcept -> literal_set
+        {
+            using traits = node_traits<node>;
+
+            constexpr auto& summary = literal_summary_v<node>;
+
+            if constexpr (summary.prefix.size > 0)
+            {
+                // Every match starts with the same literal
+                return literal_set {.literals = {summary.prefix}, .size = 1};
+            }
+            else if constexpr (traits::kind == node_kind::alternation)
+            {
+                return leading_alternation(
+                    static_cast<typename traits::children*>(nullptr));
+            }
+            else if constexpr (traits::kind == node_kind::sequence
+                               || traits::kind == node_kind::group)
+            {
+                // Literals of the head are never empty, so they start
+                // the whole match
+                return leading<typename traits::head>();
+            }
+            else if constexpr (traits::kind == node_kind::repetition)
+            {
+                if constexpr (traits::minimum > 0)
+                {
+                    return leading<typename traits::head>();
+                }
+                else
+                {
+                    return literal_set {.valid = false};
+                }
+            }
+            else
+            {
+                return literal_set {.valid = false};
+            }
+        }
+    } // namespace __private
+
+    /**
+     * @brief Set of literals one of which starts every match of node,
+     * if at most max_leading_literals of them are needed
+     */
+    template<typename node>
+    inline constexpr auto leading_literals_v = __private::leading<node>();
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_LEADING_LITERALS_HPP_*/
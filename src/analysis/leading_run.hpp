@@ -0,0 +1,67 @@
+#ifndef E_REGEX_ANALYSIS_LEADING_RUN_HPP_
+#define E_REGEX_ANALYSIS_LEADING_RUN_HPP_
+
+#include <tuple>
+
+#include "class_sequence.hpp"
+#include "node_traits.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::analysis
+{
+    namespace __private
+    {
+        template<typename node>
+        constexpr auto leading_run_of() noexcept -> byte_set
+        {
+            using traits = node_traits<node>;
+
+            if constexpr (traits::kind == node_kind::repetition)
+            {
+                if constexpr (traits::policy_ == policy::POSSESSIVE
+                              && traits::maximum == unbounded)
+                {
+                    constexpr auto& head
+                        = class_sequence_v<typename traits::head>;
+
+                    if (head.valid && head.size == 1 && head.optional == 0)
+                    {
+                        return head.bytes[0];
+                    }
+                }
+
+                return {};
+            }
+            else if constexpr (traits::kind == node_kind::sequence
+                               || traits::kind == node_kind::group)
+            {
+                return leading_run_of<typename traits::head>();
+            }
+            else if constexpr (traits::kind == node_kind::alternation
+                               && std::tuple_size_v<typename traits::children>
+                                      == 1)
+            {
+                return leading_run_of<
+                    std::tuple_element_t<0, typename traits::children>>();
+            }
+            else
+            {
+                return {};
+            }
+        }
+    } // namespace __private
+
+    /**
+     * @brief Bytes of the possessive, unbounded loop over a single
+     * class that every match of node starts with, empty if there is
+     * none
+     *
+     * The loop consumes the whole run of these bytes and never gives
+     * it back: if an attempt fails, attempts starting inside the run
+     * it consumed reach the same end of the run, and fail too.
+     */
+    template<typename node>
+    inline constexpr auto leading_run = __private::leading_run_of<node>();
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_LEADING_RUN_HPP_*/
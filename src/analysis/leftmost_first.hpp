@@ -0,0 +1,269 @@
+#ifndef E_REGEX_ANALYSIS_LEFTMOST_FIRST_HPP_
+#define E_REGEX_ANALYSIS_LEFTMOST_FIRST_HPP_
+
+#include <tuple>
+
+#include "node_traits.hpp"
+#include "nodes/common.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::analysis
+{
+    namespace __private
+    {
+        /*
+         * The backtracking matcher commits to the first way a node
+         * matches, unless the node sees its continuation: this is
+         * the case of the children of a node that sees its own one
+         * (complete context), starting from the root. Heads of
+         * sequences and bodies of loops are committed instead
+         * (atomic context).
+         */
+        enum class context
+        {
+            complete,
+            atomic
+        };
+
+        template<typename node>
+        constexpr auto first_bytes() noexcept -> byte_set
+        {
+            return byte_set::from_admitted_set<
+                typename nodes::extract_admission_set<node>::type>();
+        }
+
+        template<typename node>
+        constexpr auto nullable() noexcept -> bool
+        {
+            return node::meta.minimum_match_size == 0;
+        }
+
+        template<typename children>
+        struct alternation;
+
+        template<typename... children>
+        struct alternation<std::tuple<children...>>
+        {
+                static constexpr bool empty = sizeof...(children) == 0;
+
+                static constexpr bool nullable
+                    = empty || (__private::nullable<children>() || ...);
+
+                // Bytes that can follow a node whose children are
+                // these, given the bytes that can follow the node
+                static constexpr auto follow(const byte_set& outer) noexcept
+                    -> byte_set
+                {
+                    auto result = (byte_set {} | ... | first_bytes<children>());
+
+                    return nullable ? result | outer : result;
+                }
+
+                // A committed alternation must have at most one branch
+                // able to start at any position
+                static constexpr auto
+                    deterministic(const byte_set& follow) noexcept -> bool
+                {
+                    constexpr std::array<byte_set, sizeof...(children)> firsts {
+                        first_bytes<children>()...};
+                    constexpr std::array<bool, sizeof...(children)> nullables {
+                        __private::nullable<children>()...};
+
+                    byte_set seen;
+
+                    for (unsigned i = 0; i < firsts.size(); ++i)
+                    {
+                        if (!(seen & firsts[i]).empty())
+                        {
+                            return false;
+                        }
+
+                        if (nullables[i]
+                            && (i + 1 != firsts.size()
+                                || !(seen & follow).empty()))
+                        {
+                            // The empty branch is taken only when the
+                            // others cannot start
+                            return false;
+                        }
+
+                        seen = seen | firsts[i];
+                    }
+
+                    return true;
+                }
+        };
+
+        template<typename node, bool groups>
+        constexpr auto faithful(context ctx, const byte_set& follow) noexcept
+            -> bool;
+
+        template<typename children, bool groups>
+        struct faithful_children;
+
+        template<typename... children, bool groups>
+        struct faithful_children<std::tuple<children...>, groups>
+        {
+                static constexpr auto check(context         ctx,
+                                            const byte_set& follow) noexcept
+                    -> bool
+                {
+                    if (ctx == context::atomic
+                        && !alternation<std::tuple<children...>>::
+                            deterministic(follow))
+                    {
+                        return false;
+                    }
+
+                    return (faithful<children, groups>(ctx, follow) && ...);
+                }
+        };
+
+        template<typename traits, bool groups>
+        constexpr auto faithful_repetition(context         ctx,
+                                        const byte_set& follow) noexcept
+            -> bool
+        {
+            using head     = typename traits::head;
+            using children = alternation<typename traits::children>;
+
+            if (nullable<head>())
+            {
+                return false;
+            }
+
+            const auto continuation = children::empty
+                                          ? follow
+                                          : children::follow(follow);
+            const auto body_follow  = traits::maximum > 1
+                                          ? continuation | first_bytes<head>()
+                                          : continuation;
+
+            const auto disjoint
+                = (first_bytes<head>() & continuation).empty();
+            const auto single_byte = head::meta.minimum_match_size == 1
+                                     && head::meta.maximum_match_size == 1;
+            const auto fixed_optional
+                = traits::minimum == 0 && traits::maximum == 1
+                  && head::meta.minimum_match_size
+                         == head::meta.maximum_match_size;
+
+            bool count_exact = true;
+
+            if (traits::minimum != traits::maximum)
+            {
+                switch (traits::policy_)
+                {
+                    case policy::POSSESSIVE:
+                        count_exact = disjoint;
+                        break;
+                    case policy::GREEDY:
+                        count_exact = ctx == context::atomic
+                                          ? disjoint
+                                          : single_byte || fixed_optional;
+                        break;
+                    case policy::LAZY:
+                        count_exact
+                            = ctx == context::complete && single_byte;
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            return count_exact
+                   && faithful<head, groups>(context::atomic, body_follow)
+                   && faithful_children<typename traits::children,
+                                        groups>::check(
+                       ctx, follow);
+        }
+
+        template<typename node, bool groups>
+        constexpr auto faithful(context ctx, const byte_set& follow) noexcept
+            -> bool
+        {
+            using traits = node_traits<node>;
+
+            if constexpr (traits::kind == node_kind::bytes
+                          || traits::kind == node_kind::literal)
+            {
+                return true;
+            }
+            else if constexpr (traits::kind == node_kind::alternation)
+            {
+                return faithful_children<typename traits::children,
+                                         groups>::check(ctx, follow);
+            }
+            else if constexpr (traits::kind == node_kind::sequence)
+            {
+                using children = alternation<typename traits::children>;
+
+                const auto head_follow = children::empty
+                                             ? follow
+                                             : children::follow(follow);
+
+                return faithful<typename traits::head, groups>(
+                           context::atomic, head_follow)
+                       && faithful_children<typename traits::children,
+                                            groups>::check(ctx, follow);
+            }
+            else if constexpr (traits::kind == node_kind::repetition)
+            {
+                return faithful_repetition<traits, groups>(ctx, follow);
+            }
+            else if constexpr (traits::kind == node_kind::group
+                               && (groups || !is_capture<node>))
+            {
+                using children = alternation<typename traits::children>;
+
+                const auto head_follow = children::empty
+                                             ? follow
+                                             : children::follow(follow);
+
+                // The children of a group are injected into its
+                // children too, only committed choices are safe there
+                return faithful<typename traits::head, groups>(
+                           context::atomic, head_follow)
+                       && faithful_children<typename traits::children,
+                                            groups>::check(context::atomic,
+                                                           follow);
+            }
+            else
+            {
+                // Anchors, and capturing groups unless asked for, are
+                // left to the backtracker
+                return false;
+            }
+        }
+    } // namespace __private
+
+    /**
+     * @brief True if the backtracking matcher finds, at any position,
+     * the same match as a leftmost-first (Perl-like) automaton
+     *
+     * This is a conservative check: capture groups, anchors and
+     * empty matches are excluded, and every choice the backtracker
+     * commits to must be decided by the next byte.
+     */
+    template<typename node>
+    inline constexpr bool matches_leftmost_first
+        = node::meta.minimum_match_size > 0
+          && __private::faithful<node, false>(__private::context::complete,
+                                           byte_set {});
+
+    /**
+     * @brief True if, groups included, the backtracking matcher finds
+     * the leftmost-first match and its groups
+     *
+     * Groups are checked as committed contexts. Failed attempts of
+     * the matcher can leave stale groups, that are not part of its
+     * leftmost-first match.
+     */
+    template<typename node>
+    inline constexpr bool captures_leftmost_first
+        = node::meta.minimum_match_size > 0
+          && __private::faithful<node, true>(__private::context::complete,
+                                          byte_set {});
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_LEFTMOST_FIRST_HPP_*/
@@ -0,0 +1,417 @@
+#ifndef E_REGEX_ANALYSIS_LITERAL_HPP_
+#define E_REGEX_ANALYSIS_LITERAL_HPP_
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+#include "node_traits.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::analysis
+{
+    // Longest literal tracked by the analysis
+    inline constexpr auto max_literal_size = 32U;
+
+    struct literal
+    {
+            std::array<char, max_literal_size> chars = {};
+            unsigned                           size  = 0;
+
+            constexpr auto operator==(const literal& other) const noexcept
+                -> bool
+            {
+                return size == other.size
+                       && std::equal(chars.begin(),
+                                     chars.begin() + size,
+                                     other.chars.begin());
+            }
+
+            constexpr auto push_back(char c) const noexcept -> literal
+            {
+                return append(literal {.chars = {c}, .size = 1});
+            }
+
+            // Appends other, keeping the first max_literal_size bytes
+            constexpr auto append(const literal& other) const noexcept
+                -> literal
+            {
+                auto result = *this;
+
+                for (unsigned i = 0;
+                     i < other.size && result.size < max_literal_size;
+                     ++i)
+                {
+                    result.chars[result.size++] = other.chars[i];
+                }
+
+                return result;
+            }
+
+            constexpr auto head(unsigned n) const noexcept -> literal
+            {
+                auto result = *this;
+                result.size = std::min(n, size);
+
+                return result;
+            }
+
+            constexpr auto tail(unsigned n) const noexcept -> literal
+            {
+                literal result;
+                result.size = std::min(n, size);
+
+                for (unsigned i = 0; i < result.size; ++i)
+                {
+                    result.chars[i] = chars[size - result.size + i];
+                }
+
+                return result;
+            }
+    };
+
+    /*
+     * What every string matched by a node has in common. Offsets
+     * are relative to the start of the match; the required literal
+     * can be preceded, inside the match, only by bytes in before.
+     */
+    struct literal_summary
+    {
+            unsigned minimum = 0;
+            unsigned maximum = 0;
+
+            // The node matches exactly prefix
+            bool    exact = true;
+            literal prefix;
+            literal suffix;
+
+            literal  required;
+            unsigned required_minimum_offset = 0;
+            unsigned required_maximum_offset = 0;
+            byte_set before;
+
+            byte_set alphabet;
+    };
+
+    namespace __private
+    {
+        constexpr auto add(unsigned a, unsigned b) noexcept -> unsigned
+        {
+            return a == unbounded || b == unbounded || a + b < a
+                       ? unbounded
+                       : a + b;
+        }
+
+        constexpr auto multiply(unsigned a, unsigned b) noexcept -> unsigned
+        {
+            if (a == 0 || b == 0)
+            {
+                return 0;
+            }
+
+            return a == unbounded || b == unbounded || a > unbounded / b
+                       ? unbounded
+                       : a * b;
+        }
+
+        constexpr auto subtract(unsigned a, unsigned b) noexcept -> unsigned
+        {
+            return a == unbounded ? unbounded : a - b;
+        }
+
+        constexpr auto window(const literal_summary& summary) noexcept
+            -> unsigned
+        {
+            return subtract(summary.required_maximum_offset,
+                            summary.required_minimum_offset);
+        }
+
+        // Keeps the candidate literal that filters better: the
+        // longest one, then the one with the tightest offsets
+        constexpr void choose(literal_summary& summary,
+                              const literal&   candidate,
+                              unsigned         minimum_offset,
+                              unsigned         maximum_offset,
+                              const byte_set&  before) noexcept
+        {
+            const auto width = subtract(maximum_offset, minimum_offset);
+
+            if (candidate.size > summary.required.size
+                || (candidate.size == summary.required.size
+                    && candidate.size > 0
+                    && (width < window(summary)
+                        || (width == window(summary)
+                            && minimum_offset
+                                   < summary.required_minimum_offset))))
+            {
+                summary.required                = candidate;
+                summary.required_minimum_offset = minimum_offset;
+                summary.required_maximum_offset = maximum_offset;
+                summary.before                  = before;
+            }
+        }
+
+        constexpr auto exact_summary(const literal& value) noexcept
+            -> literal_summary
+        {
+            literal_summary result;
+            result.minimum  = value.size;
+            result.maximum  = value.size;
+            result.prefix   = value;
+            result.suffix   = value;
+            result.required = value;
+
+            for (unsigned i = 0; i < value.size; ++i)
+            {
+                result.alphabet.insert(
+                    static_cast<unsigned char>(value.chars[i]));
+            }
+
+            return result;
+        }
+
+        constexpr auto concatenate(const literal_summary& a,
+                                   const literal_summary& b) noexcept
+            -> literal_summary
+        {
+            literal_summary result;
+            result.minimum  = add(a.minimum, b.minimum);
+            result.maximum  = add(a.maximum, b.maximum);
+            result.alphabet = a.alphabet | b.alphabet;
+            result.exact    = a.exact && b.exact
+                           && a.prefix.size + b.prefix.size
+                                  <= max_literal_size;
+
+            result.prefix = a.exact ? a.prefix.append(b.prefix) : a.prefix;
+            result.suffix
+                = b.exact ? a.suffix.tail(max_literal_size - b.suffix.size)
+                                .append(b.suffix)
+                          : b.suffix;
+
+            choose(result,
+                   a.required,
+                   a.required_minimum_offset,
+                   a.required_maximum_offset,
+                   a.before);
+            choose(result,
+                   b.required,
+                   add(a.minimum, b.required_minimum_offset),
+                   add(a.maximum, b.required_maximum_offset),
+                   a.alphabet | b.before);
+
+            // The end of a followed by the start of b
+            const auto suffix
+                = a.suffix.tail(max_literal_size - b.prefix.size);
+            choose(result,
+                   suffix.append(b.prefix),
+                   a.minimum - suffix.size,
+                   subtract(a.maximum, suffix.size),
+                   a.alphabet);
+
+            return result;
+        }
+
+        constexpr auto alternate(const literal_summary& a,
+                                 const literal_summary& b) noexcept
+            -> literal_summary
+        {
+            literal_summary result;
+            result.minimum  = std::min(a.minimum, b.minimum);
+            result.maximum  = std::max(a.maximum, b.maximum);
+            result.alphabet = a.alphabet | b.alphabet;
+            result.exact    = a.exact && b.exact && a.prefix == b.prefix;
+
+            unsigned common = 0;
+            while (common < a.prefix.size && common < b.prefix.size
+                   && a.prefix.chars[common] == b.prefix.chars[common])
+            {
+                ++common;
+            }
+            result.prefix = a.prefix.head(common);
+
+            common = 0;
+            while (common < a.suffix.size && common < b.suffix.size
+                   && a.suffix.chars[a.suffix.size - common - 1]
+                          == b.suffix.chars[b.suffix.size - common - 1])
+            {
+                ++common;
+            }
+            result.suffix = a.suffix.tail(common);
+
+            if (a.required.size > 0 && a.required == b.required)
+            {
+                result.required = a.required;
+                result.required_minimum_offset
+                    = std::min(a.required_minimum_offset,
+                               b.required_minimum_offset);
+                result.required_maximum_offset
+                    = std::max(a.required_maximum_offset,
+                               b.required_maximum_offset);
+                result.before = a.before | b.before;
+            }
+
+            choose(result, result.prefix, 0, 0, byte_set {});
+            choose(result,
+                   result.suffix,
+                   result.minimum - result.suffix.size,
+                   subtract(result.maximum, result.suffix.size),
+                   result.alphabet);
+
+            return result;
+        }
+
+        constexpr auto repeat(const literal_summary& body,
+                              unsigned               minimum,
+                              unsigned               maximum) noexcept
+            -> literal_summary
+        {
+            if (minimum == 0)
+            {
+                literal_summary result;
+                result.maximum  = multiply(body.maximum, maximum);
+                result.exact    = maximum == 0;
+                result.alphabet = maximum == 0 ? byte_set {} : body.alphabet;
+
+                return result;
+            }
+
+            // The first minimum iterations are mandatory
+            auto result = body;
+            for (unsigned i = 1;
+                 i < std::min(minimum, max_literal_size) && result.exact;
+                 ++i)
+            {
+                result = concatenate(result, body);
+            }
+
+            result.minimum = multiply(body.minimum, minimum);
+            result.maximum = multiply(body.maximum, maximum);
+            result.exact   = result.exact && minimum == maximum;
+
+            if (!result.exact)
+            {
+                result.suffix = body.suffix;
+            }
+
+            return result;
+        }
+
+        template<typename node>
+        constexpr auto summarize() noexcept -> literal_summary;
+
+        template<typename children>
+        struct summarize_alternation;
+
+        template<>
+        struct summarize_alternation<std::tuple<>>
+        {
+                static constexpr auto value = literal_summary {};
+        };
+
+        template<typename child, typename... children>
+        struct summarize_alternation<std::tuple<child, children...>>
+        {
+                static constexpr auto value = []() {
+                    auto result = summarize<child>();
+                    ((result = alternate(result, summarize<children>())),
+                     ...);
+
+                    return result;
+                }();
+        };
+
+        template<typename node>
+        constexpr auto summarize() noexcept -> literal_summary
+        {
+            using traits = node_traits<node>;
+
+            constexpr auto children
+                = summarize_alternation<typename traits::children>::value;
+
+            if constexpr (traits::kind == node_kind::bytes)
+            {
+                if constexpr (traits::bytes.size() == 1)
+                {
+                    return exact_summary(literal {}.push_back(
+                        static_cast<char>(traits::bytes.at(0))));
+                }
+                else
+                {
+                    literal_summary result;
+                    result.minimum  = 1;
+                    result.maximum  = 1;
+                    result.exact    = false;
+                    result.alphabet = traits::bytes;
+
+                    return result;
+                }
+            }
+            else if constexpr (traits::kind == node_kind::literal)
+            {
+                literal value;
+                for (const auto c: traits::literal)
+                {
+                    // Longer literals are summarized by their head
+                    // and their tail
+                    value = value.tail(max_literal_size - 1).push_back(c);
+                }
+
+                if constexpr (traits::literal.size() <= max_literal_size)
+                {
+                    return exact_summary(value);
+                }
+                else
+                {
+                    literal head;
+                    for (const auto c: traits::literal)
+                    {
+                        head = head.push_back(c);
+                    }
+
+                    auto result    = exact_summary(head);
+                    result.minimum = traits::literal.size();
+                    result.maximum = traits::literal.size();
+                    result.exact   = false;
+                    result.suffix  = value;
+
+                    for (const auto c: traits::literal)
+                    {
+                        result.alphabet.insert(
+                            static_cast<unsigned char>(c));
+                    }
+
+                    return result;
+                }
+            }
+            else if constexpr (traits::kind == node_kind::start_anchor
+                               || traits::kind == node_kind::end_anchor)
+            {
+                return literal_summary {};
+            }
+            else if constexpr (traits::kind == node_kind::alternation)
+            {
+                return children;
+            }
+            else if constexpr (traits::kind == node_kind::repetition)
+            {
+                return concatenate(repeat(summarize<typename traits::head>(),
+                                          traits::minimum,
+                                          traits::maximum),
+                                   children);
+            }
+            else
+            {
+                return concatenate(summarize<typename traits::head>(),
+                                   children);
+            }
+        }
+    } // namespace __private
+
+    /**
+     * @brief Literal summary of the strings matched by node
+     */
+    template<typename node>
+    inline constexpr auto literal_summary_v = __private::summarize<node>();
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_LITERAL_HPP_*/
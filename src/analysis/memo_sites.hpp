@@ -0,0 +1,212 @@
+#ifndef E_REGEX_ANALYSIS_MEMO_SITES_HPP_
+#define E_REGEX_ANALYSIS_MEMO_SITES_HPP_
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "node_traits.hpp"
+#include "utilities/tuple_cat.hpp"
+
+namespace e_regex::analysis
+{
+    /*
+     * Greedy or lazy repetition attempted with some injected children.
+     * Repetitions with children of their own never look at the
+     * injected ones, so their continuation is always empty.
+     */
+    template<typename node, typename continuation>
+    struct memo_site
+    {};
+
+    namespace __private
+    {
+        template<typename node, typename continuation>
+        using memo_site_t = memo_site<
+            node,
+            std::conditional_t<std::tuple_size_v<typename node_traits<node>::children>
+                                   == 0,
+                               continuation,
+                               std::tuple<>>>;
+
+        template<typename list, typename... sites>
+        struct append_unique
+        {
+                using type = list;
+        };
+
+        template<typename... list, typename site, typename... sites>
+        struct append_unique<std::tuple<list...>, site, sites...>
+        {
+                using type = typename append_unique<
+                    std::conditional_t<(std::is_same_v<site, list> || ...),
+                                       std::tuple<list...>,
+                                       std::tuple<list..., site>>,
+                    sites...>::type;
+        };
+
+        template<typename list, typename other>
+        struct merge_sites;
+
+        template<typename list, typename... sites>
+        struct merge_sites<list, std::tuple<sites...>>
+        {
+                using type =
+                    typename append_unique<list, sites...>::type;
+        };
+
+        template<typename node, typename continuation>
+        struct sites_of;
+
+        // Sites of each node, all attempted with continuation
+        template<typename nodes, typename continuation, typename list = std::tuple<>>
+        struct sites_of_all
+        {
+                using type = list;
+        };
+
+        template<typename node, typename... nodes, typename continuation, typename list>
+        struct sites_of_all<std::tuple<node, nodes...>, continuation, list>
+        {
+                using type = typename sites_of_all<
+                    std::tuple<nodes...>,
+                    continuation,
+                    typename merge_sites<
+                        list,
+                        typename sites_of<node, continuation>::type>::type>::type;
+        };
+
+        // Sites of the nodes in continuation, attempted on their own
+        template<typename continuation>
+        struct continuation_sites;
+
+        template<typename... injected_children>
+        struct continuation_sites<std::tuple<injected_children...>>
+        {
+                using type = typename sites_of_all<std::tuple<injected_children...>,
+                                                   std::tuple<>>::type;
+        };
+
+        template<typename node, typename continuation>
+        struct sites_of
+        {
+                using traits = node_traits<node>;
+
+                // Mirrors which injected children each node passes on
+                static constexpr auto select()
+                {
+                    if constexpr (std::is_void_v<node>)
+                    {
+                        return std::tuple<> {};
+                    }
+                    else if constexpr (traits::kind == node_kind::bytes
+                                  || traits::kind == node_kind::literal
+                                  || traits::kind == node_kind::start_anchor
+                                  || traits::kind == node_kind::end_anchor)
+                    {
+                        return std::tuple<> {};
+                    }
+                    else if constexpr (traits::kind == node_kind::alternation)
+                    {
+                        return typename sites_of_all<typename traits::children,
+                                                     continuation>::type {};
+                    }
+                    else if constexpr (traits::kind == node_kind::sequence)
+                    {
+                        return typename merge_sites<
+                            typename sites_of<typename traits::head,
+                                              std::tuple<>>::type,
+                            typename sites_of_all<typename traits::children,
+                                                  continuation>::type>::type {};
+                    }
+                    else if constexpr (traits::kind == node_kind::group)
+                    {
+                        using children = typename traits::children;
+
+                        return typename merge_sites<
+                            typename sites_of<typename traits::head,
+                                              children>::type,
+                            typename sites_of_all<
+                                children,
+                                tuple_cat_t<children, continuation>>::type>::
+                            type {};
+                    }
+                    else if constexpr (traits::policy_ == policy::POSSESSIVE)
+                    {
+                        return typename merge_sites<
+                            typename sites_of<typename traits::head,
+                                              continuation>::type,
+                            typename sites_of_all<typename traits::children,
+                                                  std::tuple<>>::type>::type {};
+                    }
+                    else
+                    {
+                        using inner = typename merge_sites<
+                            typename sites_of<typename traits::head,
+                                              std::tuple<>>::type,
+                            typename sites_of_all<typename traits::children,
+                                                  std::tuple<>>::type>::type;
+
+                        if constexpr (traits::policy_ == policy::EXACT)
+                        {
+                            return inner {};
+                        }
+                        else if constexpr (std::tuple_size_v<
+                                               typename traits::children>
+                                           > 0)
+                        {
+                            return typename merge_sites<
+                                std::tuple<memo_site_t<node, continuation>>,
+                                inner>::type {};
+                        }
+                        else
+                        {
+                            // The injected children are also tried on
+                            // their own
+                            return typename merge_sites<
+                                typename merge_sites<
+                                    std::tuple<memo_site_t<node, continuation>>,
+                                    inner>::type,
+                                typename continuation_sites<
+                                    continuation>::type>::type {};
+                        }
+                    }
+                }
+
+                using type = decltype(select());
+        };
+
+        template<typename site, typename list>
+        struct index_of;
+
+        template<typename site, typename... list>
+        struct index_of<site, std::tuple<list...>>
+        {
+                static constexpr auto value = [] {
+                    std::size_t index = 0;
+                    ((!std::is_same_v<site, list> && (++index, true)) && ...);
+
+                    return index;
+                }();
+        };
+    } // namespace __private
+
+    /**
+     * @brief Distinct greedy and lazy repetitions of node, each with
+     * the injected children it is attempted with
+     */
+    template<typename node>
+    using memo_sites_t =
+        typename __private::sites_of<node, std::tuple<>>::type;
+
+    /**
+     * @brief Index of node attempted with injected_children in the
+     * memo sites of root
+     */
+    template<typename root, typename node, typename... injected_children>
+    inline constexpr auto memo_site_index = __private::index_of<
+        __private::memo_site_t<node, std::tuple<injected_children...>>,
+        memo_sites_t<root>>::value;
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_MEMO_SITES_HPP_*/
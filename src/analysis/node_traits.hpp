@@ -0,0 +1,200 @@
+#ifndef E_REGEX_ANALYSIS_NODE_TRAITS_HPP_
+#define E_REGEX_ANALYSIS_NODE_TRAITS_HPP_
+
+#include <array>
+#include <limits>
+#include <tuple>
+
+#include "nodes.hpp"
+#include "terminals.hpp"
+#include "utilities/byte_set.hpp"
+#include "utilities/pack_string.hpp"
+
+namespace e_regex::analysis
+{
+    inline constexpr auto unbounded = std::numeric_limits<unsigned>::max();
+
+    enum class node_kind
+    {
+        bytes,
+        literal,
+        start_anchor,
+        end_anchor,
+        sequence,
+        alternation,
+        repetition,
+        group
+    };
+
+    namespace __private
+    {
+        template<char... chars>
+        auto exact_chars(const terminals::exact_matcher<pack_string<chars...>>*)
+            -> pack_string<chars...>;
+
+        template<typename node>
+        concept exact = requires {
+            exact_chars(static_cast<const node*>(nullptr));
+        };
+
+        template<typename pack>
+        struct literal_of;
+
+        template<char... chars>
+        struct literal_of<pack_string<chars...>>
+        {
+                static constexpr std::array<char, sizeof...(chars)> value {
+                    chars...};
+        };
+    } // namespace __private
+
+    /*
+     * Uniform view of a node: a head followed by an alternation of
+     * children. Any terminal without a dedicated specialization
+     * consumes exactly one byte of its admission set.
+     */
+    template<typename node>
+    struct node_traits
+    {
+            static constexpr auto kind  = node_kind::bytes;
+            static constexpr auto bytes = byte_set::from_admitted_set<
+                typename nodes::extract_admission_set<node>::type>();
+
+            using children = std::tuple<>;
+    };
+
+    template<__private::exact node>
+    struct node_traits<node>
+    {
+            static constexpr auto kind    = node_kind::literal;
+            static constexpr auto literal
+                = __private::literal_of<decltype(__private::exact_chars(
+                    static_cast<const node*>(nullptr)))>::value;
+
+            using children = std::tuple<>;
+    };
+
+    template<>
+    struct node_traits<terminals::anchors::start>
+    {
+            static constexpr auto kind = node_kind::start_anchor;
+
+            using children = std::tuple<>;
+    };
+
+    template<>
+    struct node_traits<terminals::anchors::end>
+    {
+            static constexpr auto kind = node_kind::end_anchor;
+
+            using children = std::tuple<>;
+    };
+
+    template<typename matcher>
+    struct node_traits<nodes::negated_node<matcher>>
+    {
+            static constexpr auto kind  = node_kind::bytes;
+            static constexpr auto bytes = ~byte_set::from_admitted_set<
+                typename nodes::extract_admission_set<matcher>::type>();
+
+            using children = std::tuple<>;
+    };
+
+    template<typename matcher, typename... children_>
+    struct node_traits<nodes::simple<matcher, children_...>>
+    {
+            static constexpr auto kind = node_kind::sequence;
+
+            using head     = matcher;
+            using children = std::tuple<children_...>;
+    };
+
+    template<typename... children_>
+    struct node_traits<nodes::simple<void, children_...>>
+    {
+            static constexpr auto kind = node_kind::alternation;
+
+            using children = std::tuple<children_...>;
+    };
+
+    template<typename matcher, auto index, typename... children_>
+    struct node_traits<nodes::group<matcher, index, children_...>>
+    {
+            static constexpr auto kind        = node_kind::group;
+            static constexpr auto group_index = index;
+
+            using head     = matcher;
+            using children = std::tuple<children_...>;
+    };
+
+    template<typename matcher, typename... children_>
+    struct node_traits<nodes::uncaptured_group<matcher, children_...>>
+    {
+            static constexpr auto kind = node_kind::group;
+
+            using head     = matcher;
+            using children = std::tuple<children_...>;
+    };
+
+    template<typename matcher,
+             policy   policy__,
+             unsigned min,
+             unsigned max,
+             typename... children_>
+    struct repetition_traits
+    {
+            static constexpr auto kind    = node_kind::repetition;
+            static constexpr auto policy_ = policy__;
+            static constexpr auto minimum = min;
+            static constexpr auto maximum = max;
+
+            using head     = matcher;
+            using children = std::tuple<children_...>;
+    };
+
+    template<typename matcher, unsigned min, unsigned max, typename... children>
+    struct node_traits<nodes::greedy<matcher, min, max, children...>>
+        : public repetition_traits<matcher,
+                                   policy::GREEDY,
+                                   min,
+                                   max,
+                                   children...>
+    {};
+
+    template<typename matcher, unsigned min, unsigned max, typename... children>
+    struct node_traits<nodes::lazy<matcher, min, max, children...>>
+        : public repetition_traits<matcher,
+                                   policy::LAZY,
+                                   min,
+                                   max,
+                                   children...>
+    {};
+
+    template<typename matcher, unsigned min, unsigned max, typename... children>
+    struct node_traits<nodes::possessive<matcher, min, max, children...>>
+        : public repetition_traits<matcher,
+                                   policy::POSSESSIVE,
+                                   min,
+                                   max,
+                                   children...>
+    {};
+
+    template<typename matcher, unsigned repetitions, typename... children>
+    struct node_traits<nodes::repeated<matcher, repetitions, children...>>
+        : public repetition_traits<matcher,
+                                   policy::EXACT,
+                                   repetitions,
+                                   repetitions,
+                                   children...>
+    {};
+
+    // True for groups recording their match
+    template<typename node>
+    inline constexpr bool is_capture = false;
+
+    template<typename matcher, auto index, typename... children>
+    inline constexpr bool
+        is_capture<nodes::group<matcher, index, children...>> = true;
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_NODE_TRAITS_HPP_*/
@@ -0,0 +1,67 @@
+#ifndef E_REGEX_ANALYSIS_PREFIX_SHIFTS_HPP_
+#define E_REGEX_ANALYSIS_PREFIX_SHIFTS_HPP_
+
+#include <array>
+
+#include "literal.hpp"
+
+namespace e_regex::analysis
+{
+    /*
+     * Failure function of the literal every match starts with: if an
+     * attempt at p found only the first m bytes of the prefix, no
+     * match starts before p + shift[m].
+     */
+    struct prefix_shifts
+    {
+            literal prefix;
+
+            std::array<unsigned, max_literal_size + 1> shift = {};
+    };
+
+    namespace __private
+    {
+        constexpr auto make_prefix_shifts(const literal& prefix) noexcept
+            -> prefix_shifts
+        {
+            prefix_shifts result {.prefix = prefix};
+
+            // Longest proper border of each head of the prefix
+            std::array<unsigned, max_literal_size + 1> border = {};
+
+            for (unsigned m = 2; m <= prefix.size; ++m)
+            {
+                auto length = border[m - 1];
+
+                while (length > 0
+                       && prefix.chars[length] != prefix.chars[m - 1])
+                {
+                    length = border[length];
+                }
+
+                border[m] = prefix.chars[length] == prefix.chars[m - 1]
+                                ? length + 1
+                                : 0;
+            }
+
+            result.shift[0] = 1;
+
+            for (unsigned m = 1; m <= prefix.size; ++m)
+            {
+                result.shift[m] = m - border[m];
+            }
+
+            return result;
+        }
+    } // namespace __private
+
+    /**
+     * @brief Shifts of the literal prefix of node, that is empty if
+     * matches share none
+     */
+    template<typename node>
+    inline constexpr auto prefix_shifts_v = __private::make_prefix_shifts(
+        literal_summary_v<node>.prefix);
+} // namespace e_regex::analysis
+
+#endif /* E_REGEX_ANALYSIS_PREFIX_SHIFTS_HPP_*/
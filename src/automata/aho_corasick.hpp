@@ -0,0 +1,456 @@
+#ifndef E_REGEX_AUTOMATA_AHO_CORASICK_HPP_
+#define E_REGEX_AUTOMATA_AHO_CORASICK_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "analysis/literal.hpp"
+#include "analysis/node_traits.hpp"
+#include "search/searcher.hpp"
+
+namespace e_regex::automata
+{
+    namespace __private
+    {
+        inline constexpr auto no_slot = std::numeric_limits<unsigned>::max();
+
+        // Literals matched by the branches of node in priority order,
+        // 0 if node is not an alternation of literals
+        template<typename node>
+        constexpr auto keyword_count() noexcept -> unsigned;
+
+        template<typename... children>
+        constexpr auto keyword_count(std::tuple<children...>*) noexcept
+            -> unsigned
+        {
+            if constexpr (sizeof...(children) == 0)
+            {
+                return 0;
+            }
+            else if constexpr (((keyword_count<children>() > 0) && ...))
+            {
+                return (keyword_count<children>() + ...);
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+        template<typename node>
+        constexpr auto keyword_count() noexcept -> unsigned
+        {
+            using traits = analysis::node_traits<node>;
+
+            constexpr auto& summary = analysis::literal_summary_v<node>;
+
+            if constexpr (traits::kind == analysis::node_kind::alternation)
+            {
+                return keyword_count(
+                    static_cast<typename traits::children*>(nullptr));
+            }
+            else
+            {
+                return summary.exact && summary.prefix.size > 0 ? 1 : 0;
+            }
+        }
+
+        template<typename node>
+        constexpr void collect_keywords(std::vector<analysis::literal>& result);
+
+        template<typename... children>
+        constexpr void collect_keywords(std::vector<analysis::literal>& result,
+                                        std::tuple<children...>*)
+        {
+            (collect_keywords<children>(result), ...);
+        }
+
+        template<typename node>
+        constexpr void collect_keywords(std::vector<analysis::literal>& result)
+        {
+            using traits = analysis::node_traits<node>;
+
+            if constexpr (traits::kind == analysis::node_kind::alternation)
+            {
+                collect_keywords(
+                    result, static_cast<typename traits::children*>(nullptr));
+            }
+            else
+            {
+                result.push_back(analysis::literal_summary_v<node>.prefix);
+            }
+        }
+
+        struct trie_node
+        {
+                std::vector<std::pair<unsigned char, unsigned>> next;
+
+                unsigned fail  = 0;
+                unsigned depth = 0;
+
+                // Highest priority keyword ending here, and the next
+                // node of the failure chain where one ends
+                unsigned keyword = no_slot;
+                unsigned output  = no_slot;
+
+                constexpr auto child(unsigned char c) const noexcept
+                    -> unsigned
+                {
+                    for (const auto& [byte, node]: next)
+                    {
+                        if (byte == c)
+                        {
+                            return node;
+                        }
+                    }
+
+                    return no_slot;
+                }
+        };
+
+        // Trie of the keywords with failure links, in BFS order
+        constexpr auto make_trie(const std::vector<analysis::literal>& keywords)
+            -> std::vector<trie_node>
+        {
+            std::vector<trie_node> nodes(1);
+
+            for (unsigned k = 0; k < keywords.size(); ++k)
+            {
+                unsigned node = 0;
+
+                for (unsigned i = 0; i < keywords[k].size; ++i)
+                {
+                    const auto c = static_cast<unsigned char>(keywords[k].chars[i]);
+                    auto       next = nodes[node].child(c);
+
+                    if (next == no_slot)
+                    {
+                        next = static_cast<unsigned>(nodes.size());
+                        nodes[node].next.emplace_back(c, next);
+                        auto& child = nodes.emplace_back();
+                        child.depth = nodes[node].depth + 1;
+                    }
+
+                    node = next;
+                }
+
+                if (nodes[node].keyword == no_slot)
+                {
+                    nodes[node].keyword = k;
+                }
+            }
+
+            std::vector<unsigned> queue {0};
+
+            for (unsigned i = 0; i < queue.size(); ++i)
+            {
+                const auto node = queue[i];
+
+                for (const auto& [c, next]: nodes[node].next)
+                {
+                    unsigned fail = 0;
+
+                    if (node != 0)
+                    {
+                        fail = nodes[node].fail;
+
+                        while (fail != 0 && nodes[fail].child(c) == no_slot)
+                        {
+                            fail = nodes[fail].fail;
+                        }
+
+                        if (nodes[fail].child(c) != no_slot)
+                        {
+                            fail = nodes[fail].child(c);
+                        }
+                    }
+
+                    nodes[next].fail   = fail;
+                    nodes[next].output = nodes[fail].keyword != no_slot
+                                             ? fail
+                                             : nodes[fail].output;
+                    queue.push_back(next);
+                }
+            }
+
+            // Renumbered in BFS order, so that parents are placed
+            // before their children
+            std::vector<unsigned> renamed(nodes.size());
+            for (unsigned i = 0; i < queue.size(); ++i)
+            {
+                renamed[queue[i]] = i;
+            }
+
+            std::vector<trie_node> result(nodes.size());
+            for (unsigned i = 0; i < nodes.size(); ++i)
+            {
+                auto& node = result[renamed[i]];
+                node       = nodes[i];
+                node.fail  = renamed[node.fail];
+
+                if (node.output != no_slot)
+                {
+                    node.output = renamed[node.output];
+                }
+
+                for (auto& [c, next]: node.next)
+                {
+                    next = renamed[next];
+                }
+            }
+
+            return result;
+        }
+
+        // Trie node stored in a double array
+        struct slot
+        {
+                // Children of the slot are at base + byte, if their
+                // check is the slot
+                std::uint32_t base  = 0;
+                std::uint32_t check = no_slot;
+
+                std::uint32_t fail    = 0;
+                std::uint32_t output  = no_slot;
+                std::uint32_t keyword = no_slot;
+                std::uint32_t depth   = 0;
+        };
+
+        /*
+         * Places every node at the first slot where its children fit.
+         * The array is padded with 256 free slots, so that base + byte
+         * is always in bounds.
+         */
+        constexpr auto make_double_array(const std::vector<trie_node>& trie)
+            -> std::vector<slot>
+        {
+            std::vector<unsigned> slot_of(trie.size(), 0);
+            std::vector<slot>     result(1 + 256);
+            result[0].check = 0;
+
+            unsigned first_free = 1;
+
+            for (unsigned node = 0; node < trie.size(); ++node)
+            {
+                const auto& children = trie[node].next;
+                const auto  current  = slot_of[node];
+
+                if (!children.empty())
+                {
+                    while (result[first_free].check != no_slot)
+                    {
+                        ++first_free;
+                    }
+
+                    auto base = first_free > children[0].first
+                                    ? first_free - children[0].first
+                                    : 1U;
+
+                    for (;; ++base)
+                    {
+                        bool fits = true;
+
+                        for (const auto& [c, next]: children)
+                        {
+                            fits = fits
+                                   && (base + c >= result.size()
+                                       || result[base + c].check == no_slot);
+                        }
+
+                        if (fits)
+                        {
+                            break;
+                        }
+                    }
+
+                    if (result.size() < base + 256 + 256)
+                    {
+                        result.resize(base + 256 + 256);
+                    }
+
+                    result[current].base = base;
+
+                    for (const auto& [c, next]: children)
+                    {
+                        result[base + c].check = current;
+                        slot_of[next]          = base + c;
+                    }
+                }
+            }
+
+            for (unsigned node = 0; node < trie.size(); ++node)
+            {
+                auto& placed   = result[slot_of[node]];
+                placed.fail    = slot_of[trie[node].fail];
+                placed.keyword = trie[node].keyword;
+                placed.depth   = trie[node].depth;
+                placed.output  = trie[node].output == no_slot
+                                     ? no_slot
+                                     : slot_of[trie[node].output];
+            }
+
+            // Only the padding after the last used slot is kept
+            auto last = result.size();
+            while (last > 1 && result[last - 1].check == no_slot)
+            {
+                --last;
+            }
+            result.resize(last + 256);
+
+            return result;
+        }
+
+        template<typename node>
+        constexpr auto build_double_array() -> std::vector<slot>
+        {
+            std::vector<analysis::literal> keywords;
+            collect_keywords<node>(keywords);
+
+            return make_double_array(make_trie(keywords));
+        }
+
+        template<typename node>
+        inline constexpr auto slot_count = build_double_array<node>().size();
+
+        template<typename node, std::size_t slots>
+        inline constexpr auto double_array = [] {
+            std::array<slot, slots> result;
+
+            if constexpr (slots > 0)
+            {
+                const auto built = build_double_array<node>();
+                for (unsigned i = 0; i < slots; ++i)
+                {
+                    result[i] = built[i];
+                }
+            }
+
+            return result;
+        }();
+    } // namespace __private
+
+    /*
+     * Aho-Corasick automaton of an alternation of literals, stored as
+     * a double-array trie with failure links. A single scan finds the
+     * leftmost match, choosing the first branch among the ones that
+     * match there, as the regex tree would.
+     */
+    template<typename matcher>
+    struct aho_corasick
+    {
+            static constexpr auto keywords
+                = __private::keyword_count<matcher>();
+
+            static constexpr bool enabled
+                = analysis::node_traits<matcher>::kind
+                      == analysis::node_kind::alternation
+                  && keywords > 1;
+
+        private:
+            using searcher = search::searcher<matcher>;
+
+            static constexpr auto slot_count = [] {
+                if constexpr (enabled)
+                {
+                    return __private::slot_count<matcher>;
+                }
+                else
+                {
+                    return std::size_t {0};
+                }
+            }();
+
+            static constexpr auto& slots
+                = __private::double_array<matcher, slot_count>;
+
+        public:
+            /**
+             * @brief Finds the first match in [begin, end)
+             *
+             * @return false if there is none, otherwise the match is
+             * stored in match_begin and match_end, and the index of
+             * its branch in keyword
+             */
+            static constexpr __attribute__((always_inline)) auto
+                find(const char*               begin,
+                     const char*               end,
+                     typename searcher::state& search_state,
+                     const char*&              match_begin,
+                     const char*&              match_end,
+                     unsigned&                 keyword) noexcept -> bool
+            {
+                const char* found = nullptr;
+                unsigned    state = 0;
+
+                for (const auto* current = begin; current < end;)
+                {
+                    if (state == 0 && found == nullptr)
+                    {
+                        current = searcher::find(current, end, search_state);
+
+                        if (current >= end)
+                        {
+                            break;
+                        }
+                    }
+
+                    const auto c = static_cast<unsigned char>(*current);
+                    ++current;
+
+                    while (slots[slots[state].base + c].check != state
+                           && state != 0)
+                    {
+                        state = slots[state].fail;
+                    }
+
+                    if (slots[slots[state].base + c].check == state)
+                    {
+                        state = slots[state].base + c;
+                    }
+
+                    // Nothing still alive can start at or before the
+                    // match found
+                    if (found != nullptr
+                        && current - slots[state].depth > found)
+                    {
+                        break;
+                    }
+
+                    auto output = slots[state].keyword != __private::no_slot
+                                      ? state
+                                      : slots[state].output;
+
+                    for (; output != __private::no_slot;
+                         output = slots[output].output)
+                    {
+                        const auto* start = current - slots[output].depth;
+
+                        if (found == nullptr || start < found
+                            || (start == found
+                                && slots[output].keyword < keyword))
+                        {
+                            found     = start;
+                            match_end = current;
+                            keyword   = slots[output].keyword;
+                        }
+                    }
+                }
+
+                if (found == nullptr)
+                {
+                    return false;
+                }
+
+                match_begin = found;
+
+                return true;
+            }
+    };
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_AHO_CORASICK_HPP_*/
@@ -0,0 +1,289 @@
+#ifndef E_REGEX_AUTOMATA_BIT_NFA_HPP_
+#define E_REGEX_AUTOMATA_BIT_NFA_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "analysis/anchors.hpp"
+#include "byte_classes.hpp"
+#include "dfa.hpp"
+#include "position_automaton.hpp"
+#include "search/first_byte.hpp"
+
+namespace e_regex::automata
+{
+    namespace __private
+    {
+        // Positions whose follow sets are merged by a single lookup
+        inline constexpr auto chunk_bits = 8U;
+
+        template<unsigned words>
+        struct position_set
+        {
+                std::array<std::uint64_t, words> bits = {};
+
+                constexpr void insert(unsigned position) noexcept
+                {
+                    bits[position / 64] |= std::uint64_t {1}
+                                            << (position % 64);
+                }
+
+                constexpr auto operator|=(const position_set& other) noexcept
+                    -> position_set&
+                {
+                    for (unsigned w = 0; w < words; ++w)
+                    {
+                        bits[w] |= other.bits[w];
+                    }
+
+                    return *this;
+                }
+
+                constexpr auto operator&=(const position_set& other) noexcept
+                    -> position_set&
+                {
+                    for (unsigned w = 0; w < words; ++w)
+                    {
+                        bits[w] &= other.bits[w];
+                    }
+
+                    return *this;
+                }
+
+                constexpr auto intersects(const position_set& other)
+                    const noexcept -> bool
+                {
+                    std::uint64_t result = 0;
+
+                    for (unsigned w = 0; w < words; ++w)
+                    {
+                        result |= bits[w] & other.bits[w];
+                    }
+
+                    return result != 0;
+                }
+
+                constexpr auto empty() const noexcept -> bool
+                {
+                    return std::all_of(bits.begin(),
+                                       bits.end(),
+                                       [](auto word) { return word == 0; });
+                }
+        };
+
+        template<unsigned positions, unsigned classes>
+        struct bit_tables
+        {
+                static constexpr auto words  = (positions + 63) / 64;
+                static constexpr auto chunks = (positions + chunk_bits - 1)
+                                               / chunk_bits;
+
+                using set = position_set<words>;
+
+                // Positions admitting each byte class
+                std::array<set, classes> admits = {};
+
+                // Union of the follow sets of the positions in each
+                // value of each chunk
+                std::array<std::array<set, 1U << chunk_bits>, chunks> follow
+                    = {};
+
+                set  first;
+                set  last;
+                bool nullable = false;
+        };
+
+        template<typename node, unsigned positions, unsigned classes>
+        constexpr auto make_bit_tables() -> bit_tables<positions, classes>
+        {
+            const auto  automaton = make_position_automaton<node>();
+            const auto& map       = class_map<node>;
+
+            bit_tables<positions, classes> result;
+
+            std::array<typename bit_tables<positions, classes>::set,
+                       positions>
+                follow = {};
+
+            for (unsigned p = 0; p < automaton.positions.size(); ++p)
+            {
+                const auto& position = automaton.positions[p];
+
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    if (position.bytes.contains(c))
+                    {
+                        result.admits[map.class_of[c]].insert(p);
+                    }
+                }
+
+                for (const auto next: position.follow)
+                {
+                    if (next == accept)
+                    {
+                        result.last.insert(p);
+                    }
+                    else
+                    {
+                        follow[p].insert(next);
+                    }
+                }
+            }
+
+            for (const auto item: automaton.first)
+            {
+                if (item == accept)
+                {
+                    result.nullable = true;
+                }
+                else
+                {
+                    result.first.insert(item);
+                }
+            }
+
+            for (unsigned chunk = 0; chunk < result.chunks; ++chunk)
+            {
+                for (unsigned value = 0; value < (1U << chunk_bits); ++value)
+                {
+                    for (unsigned bit = 0; bit < chunk_bits; ++bit)
+                    {
+                        const auto p = chunk * chunk_bits + bit;
+
+                        if ((value & (1U << bit)) != 0 && p < positions)
+                        {
+                            result.follow[chunk][value] |= follow[p];
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+    } // namespace __private
+
+    /*
+     * Glushkov automaton of an expression simulated with a bit per
+     * position: each byte costs a few table lookups, ORs and ANDs,
+     * whatever the backtracking would have done. Quantifier policies
+     * are ignored, so it answers whether a match can exist, not which
+     * one the regex tree picks.
+     */
+    template<typename matcher>
+    struct bit_nfa
+    {
+            static constexpr bool enabled
+                = !analysis::has_anchor<matcher>
+                  && position_count<matcher> <= max_positions;
+
+        private:
+            static constexpr auto positions = [] {
+                if constexpr (enabled)
+                {
+                    return std::max(position_count<matcher>, 1U);
+                }
+                else
+                {
+                    return 1U;
+                }
+            }();
+
+            static constexpr auto classes = [] {
+                if constexpr (enabled)
+                {
+                    return class_map<matcher>.count;
+                }
+                else
+                {
+                    return 1U;
+                }
+            }();
+
+            using tables = __private::bit_tables<positions, classes>;
+            using set    = typename tables::set;
+
+            static constexpr auto data = [] {
+                if constexpr (enabled)
+                {
+                    return __private::
+                        make_bit_tables<matcher, positions, classes>();
+                }
+                else
+                {
+                    return tables {};
+                }
+            }();
+
+        public:
+            /**
+             * @brief Finds where the earliest ending match in
+             * [begin, end) ends
+             *
+             * @return nullptr if there is no match
+             */
+            static constexpr __attribute__((always_inline)) auto
+                find_end(const char* begin, const char* end) noexcept
+                -> const char*
+            {
+                constexpr auto& class_of = class_map<matcher>.class_of;
+
+                if (data.nullable)
+                {
+                    return begin;
+                }
+
+                set active;
+
+                for (const auto* current = begin; current < end;)
+                {
+                    if (active.empty())
+                    {
+                        // Only a new attempt can make progress
+                        current = search::first_byte<matcher>::find(current,
+                                                                    end);
+
+                        if (current >= end)
+                        {
+                            break;
+                        }
+                    }
+
+                    const auto c = static_cast<unsigned char>(*current);
+                    ++current;
+
+                    // A new attempt starts at every byte
+                    auto next = data.first;
+
+                    for (unsigned w = 0; w < tables::words; ++w)
+                    {
+                        auto chunk = w * (64 / __private::chunk_bits);
+
+                        for (auto word = active.bits[w]; word != 0;
+                             word >>= __private::chunk_bits, ++chunk)
+                        {
+                            constexpr auto mask
+                                = (1U << __private::chunk_bits) - 1;
+
+                            if ((word & mask) != 0)
+                            {
+                                next |= data.follow[chunk][word & mask];
+                            }
+                        }
+                    }
+
+                    next &= data.admits[class_of[c]];
+                    active = next;
+
+                    if (active.intersects(data.last))
+                    {
+                        return current;
+                    }
+                }
+
+                return nullptr;
+            }
+    };
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_BIT_NFA_HPP_*/
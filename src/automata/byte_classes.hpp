@@ -0,0 +1,188 @@
+#ifndef E_REGEX_AUTOMATA_BYTE_CLASSES_HPP_
+#define E_REGEX_AUTOMATA_BYTE_CLASSES_HPP_
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "analysis/node_traits.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::automata
+{
+    /*
+     * Partition of the 256 byte values: bytes of the same class are
+     * admitted by the same terminals, so automata can key their
+     * transitions by class instead of by byte.
+     */
+    struct byte_classes
+    {
+            std::array<std::uint8_t, 256> class_of = {};
+
+            // A byte of each class
+            std::vector<unsigned char> representative {0};
+
+            // Bytes already alone in their class
+            byte_set isolated;
+
+            constexpr auto count() const noexcept -> unsigned
+            {
+                return representative.size();
+            }
+
+            // Splits the classes crossed by bytes, so that no class is
+            // ever left empty
+            constexpr void refine(const byte_set& bytes)
+            {
+                std::vector<unsigned> inside(representative.size());
+                std::vector<unsigned> total(representative.size());
+
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    ++total[class_of[c]];
+                    inside[class_of[c]] += bytes.contains(c) ? 1 : 0;
+                }
+
+                // Old id -> new id
+                std::vector<int> split(representative.size(), -1);
+
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    const auto id = class_of[c];
+
+                    if (!bytes.contains(c) || inside[id] == total[id])
+                    {
+                        continue;
+                    }
+
+                    if (split[id] < 0)
+                    {
+                        // Bytes of the class inside the set move to a
+                        // new one
+                        split[id] = static_cast<int>(representative.size());
+                        representative.push_back(
+                            static_cast<unsigned char>(c));
+                    }
+
+                    class_of[c] = static_cast<std::uint8_t>(split[id]);
+                }
+            }
+
+            // Moves c to a class of its own, once for each byte: long
+            // literals would otherwise repeat the same refinements
+            constexpr void isolate(unsigned char c)
+            {
+                if (isolated.contains(c))
+                {
+                    return;
+                }
+
+                byte_set bytes;
+                bytes.insert(c);
+
+                refine(bytes);
+                isolated.insert(c);
+            }
+
+            // Renumbers classes in the order of their first byte
+            constexpr auto compact() const -> byte_classes
+            {
+                byte_classes result;
+                result.representative.clear();
+                std::vector<int> renamed(representative.size(), -1);
+
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    auto& id = renamed[class_of[c]];
+
+                    if (id < 0)
+                    {
+                        id = static_cast<int>(result.representative.size());
+                        result.representative.push_back(
+                            static_cast<unsigned char>(c));
+                    }
+
+                    result.class_of[c] = static_cast<std::uint8_t>(id);
+                }
+
+                return result;
+            }
+    };
+
+    namespace __private
+    {
+        template<typename node>
+        constexpr void collect_classes(byte_classes& classes);
+
+        template<typename... children>
+        constexpr void collect_children(byte_classes& classes,
+                                        std::tuple<children...>*)
+        {
+            (collect_classes<children>(classes), ...);
+        }
+
+        template<typename node>
+        constexpr void collect_classes(byte_classes& classes)
+        {
+            using traits = analysis::node_traits<node>;
+
+            if constexpr (traits::kind == analysis::node_kind::bytes)
+            {
+                classes.refine(traits::bytes);
+            }
+            else if constexpr (traits::kind == analysis::node_kind::literal)
+            {
+                for (const auto c: traits::literal)
+                {
+                    classes.isolate(static_cast<unsigned char>(c));
+                }
+            }
+            else if constexpr (traits::kind
+                                   != analysis::node_kind::start_anchor
+                               && traits::kind
+                                      != analysis::node_kind::end_anchor)
+            {
+                if constexpr (traits::kind
+                              != analysis::node_kind::alternation)
+                {
+                    collect_classes<typename traits::head>(classes);
+                }
+
+                collect_children(
+                    classes, static_cast<typename traits::children*>(nullptr));
+            }
+        }
+    } // namespace __private
+
+    /**
+     * @brief Coarsest partition of bytes separating every set
+     * admitted by a terminal of node
+     */
+    template<typename node>
+    constexpr auto partition() -> byte_classes
+    {
+        byte_classes result;
+        __private::collect_classes<node>(result);
+
+        return result.compact();
+    }
+
+    /**
+     * @brief Byte to class map of node, with the number of classes
+     */
+    template<typename node>
+    inline constexpr auto class_map = [] {
+        const auto classes = partition<node>();
+
+        struct
+        {
+                std::array<std::uint8_t, 256> class_of;
+                unsigned                      count;
+        } result {classes.class_of, classes.count()};
+
+        return result;
+    }();
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_BYTE_CLASSES_HPP_*/
@@ -0,0 +1,1014 @@
+#ifndef E_REGEX_AUTOMATA_DFA_HPP_
+#define E_REGEX_AUTOMATA_DFA_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "analysis/leftmost_first.hpp"
+#include "analysis/literal.hpp"
+#include "byte_classes.hpp"
+#include "nodes/common.hpp"
+#include "position_automaton.hpp"
+#include "search/searcher.hpp"
+#include "search/substring.hpp"
+
+namespace e_regex::automata
+{
+    // Largest automata built at compile time
+    inline constexpr auto max_states = 256U;
+
+    /*
+     * Work allowed to build the automata of a regex, in items read
+     * and states compared: past it, the constant evaluation of the
+     * tables would run out of operations, so the DFA is given up
+     */
+    inline constexpr std::size_t max_construction_cost = 1U << 17U;
+
+    // Dead and start state of every table
+    inline constexpr std::uint8_t dead  = 0;
+    inline constexpr std::uint8_t start = 1;
+
+    namespace __private
+    {
+        // Deterministic automaton over byte classes, as it is built
+        struct table
+        {
+                // Transitions, states * classes
+                std::vector<unsigned> next;
+                std::vector<bool>     accepting;
+
+                unsigned classes = 0;
+                bool     valid   = true;
+
+                constexpr auto states() const noexcept -> unsigned
+                {
+                    return accepting.size();
+                }
+        };
+
+        /*
+         * Work done by the construction, charged as it goes: once past
+         * max_construction_cost the tables being built are given up
+         */
+        struct cost
+        {
+                std::size_t spent = 0;
+
+                constexpr void charge(std::size_t work) noexcept
+                {
+                    spent += work;
+                }
+
+                constexpr auto exceeded() const noexcept -> bool
+                {
+                    return spent > max_construction_cost;
+                }
+        };
+
+        // Bookkeeping of a transition, as many items: the step and
+        // the lookup of the state it leads to
+        inline constexpr std::size_t transition_cost = 32;
+
+        /*
+         * Item lists of the states found so far, stored back to back
+         * and told apart by a hash first: nested vectors and their
+         * comparisons are slow during constant evaluation
+         */
+        struct state_lists
+        {
+                std::vector<item>     items;
+                std::vector<unsigned> offsets {0};
+                std::vector<unsigned> hashes;
+
+                constexpr auto size() const noexcept -> unsigned
+                {
+                    return hashes.size();
+                }
+
+                // Copies the list of state into list
+                constexpr void get(unsigned           state,
+                                   std::vector<item>& list) const
+                {
+                    list.assign(items.begin() + offsets[state],
+                                items.begin() + offsets[state + 1]);
+                }
+
+                // Index of the state made of list, added if new
+                constexpr auto intern(const item* list,
+                                      unsigned    length,
+                                      cost&       spent) -> unsigned
+                {
+                    unsigned hash = length;
+
+                    for (unsigned i = 0; i < length; ++i)
+                    {
+                        hash = hash * 31U + static_cast<unsigned>(list[i]);
+                    }
+
+                    const auto* known  = hashes.data();
+                    const auto* bounds = offsets.data();
+                    const auto  count  = size();
+
+                    spent.charge(count);
+
+                    for (unsigned s = 0; s < count; ++s)
+                    {
+                        if (known[s] != hash
+                            || bounds[s + 1] - bounds[s] != length)
+                        {
+                            continue;
+                        }
+
+                        spent.charge(length);
+
+                        if (std::equal(
+                                list, list + length, items.data() + bounds[s]))
+                        {
+                            return s;
+                        }
+                    }
+
+                    items.insert(items.end(), list, list + length);
+                    offsets.push_back(items.size());
+                    hashes.push_back(hash);
+
+                    return count;
+                }
+        };
+
+        /*
+         * Buffers reused by every step: an item is in list if its
+         * mark is the current generation, so that they are never
+         * cleared
+         */
+        struct step_buffers
+        {
+                std::vector<item>     list;
+                std::vector<unsigned> marks;
+                unsigned              generation = 0;
+
+                constexpr explicit step_buffers(unsigned items)
+                    : list(items)
+                    , marks(items)
+                {}
+        };
+
+        /*
+         * Leftmost-first unanchored search: a state is the ordered
+         * list of the threads alive, the older ones first. Restart
+         * starts a new thread at every byte; once a thread accepts,
+         * the ones after it can be dropped.
+         *
+         * The next list is left in buffers, its size is returned.
+         */
+        constexpr auto step(const position_automaton& automaton,
+                            const std::vector<item>&  threads,
+                            unsigned char             c,
+                            step_buffers&             buffers) -> unsigned
+        {
+            auto*      result     = buffers.list.data();
+            auto*      added      = buffers.marks.data();
+            const auto generation = ++buffers.generation;
+
+            unsigned size     = 0;
+            bool     accepted = false;
+
+            const auto append = [&](item i) {
+                if (!accepted && added[i - restart] != generation)
+                {
+                    added[i - restart] = generation;
+                    result[size++]     = i;
+                    accepted           = i == accept;
+                }
+            };
+
+            const auto* positions = automaton.positions.data();
+
+            for (const auto thread: threads)
+            {
+                if (thread >= 0)
+                {
+                    const auto& position = positions[thread];
+
+                    if (position.bytes.contains(c))
+                    {
+                        const auto* follow = position.follow.data();
+
+                        for (unsigned i = 0; i < position.follow.size(); ++i)
+                        {
+                            append(follow[i]);
+                        }
+                    }
+                }
+                else if (thread == restart)
+                {
+                    const auto* first = automaton.first.data();
+
+                    for (unsigned i = 0; i < automaton.first.size(); ++i)
+                    {
+                        append(first[i]);
+                    }
+
+                    append(restart);
+                }
+            }
+
+            return size;
+        }
+
+        constexpr auto forward(const position_automaton& automaton,
+                               const byte_classes&       classes,
+                               cost&                     spent) -> table
+        {
+            const auto items = automaton.positions.size() - restart;
+
+            state_lists  states;
+            step_buffers buffers {static_cast<unsigned>(items)};
+
+            auto initial = automaton.first;
+            initial.push_back(restart);
+
+            states.intern(nullptr, 0, spent);
+            states.intern(initial.data(), initial.size(), spent);
+
+            table result;
+            result.classes = classes.count();
+
+            std::vector<item> threads;
+            threads.reserve(items);
+
+            for (unsigned i = 0; i < states.size(); ++i)
+            {
+                states.get(i, threads);
+                spent.charge((threads.size() + transition_cost)
+                             * classes.count());
+
+                if (states.size() > max_states || spent.exceeded())
+                {
+                    result.valid = false;
+                    return result;
+                }
+
+                result.accepting.push_back(
+                    std::find(threads.begin(), threads.end(), accept)
+                    != threads.end());
+
+                for (const auto c: classes.representative)
+                {
+                    const auto size = step(automaton, threads, c, buffers);
+
+                    result.next.push_back(
+                        states.intern(buffers.list.data(), size, spent));
+                }
+            }
+
+            result.valid = !spent.exceeded();
+
+            return result;
+        }
+
+        /*
+         * Reverse automaton, run backwards from the end of a match:
+         * a state is the set of positions that can have consumed the
+         * last byte read. It accepts where a match can begin.
+         */
+        constexpr auto reverse(const position_automaton& automaton,
+                               const byte_classes&       classes,
+                               cost&                     spent) -> table
+        {
+            const auto count = automaton.positions.size();
+
+            state_lists  states;
+            step_buffers buffers {static_cast<unsigned>(count)};
+
+            const std::array<item, 1> ending {accept};
+            states.intern(nullptr, 0, spent);
+            states.intern(ending.data(), ending.size(), spent);
+
+            // Positions followed by each item, accept first
+            std::vector<std::vector<item>> predecessors(count + 1);
+
+            // Items a match can begin with, accept first
+            std::vector<bool> initial(count + 1);
+            for (const auto position: automaton.first)
+            {
+                if (position >= accept)
+                {
+                    initial[position + 1] = true;
+                }
+            }
+
+            for (unsigned p = 0; p < count; ++p)
+            {
+                for (const auto next: automaton.positions[p].follow)
+                {
+                    if (next >= accept)
+                    {
+                        predecessors[next + 1].push_back(static_cast<item>(p));
+                    }
+                }
+            }
+
+            table result;
+            result.classes = classes.count();
+
+            std::vector<item> positions;
+            positions.reserve(count + 1);
+
+            for (unsigned i = 0; i < states.size(); ++i)
+            {
+                states.get(i, positions);
+                spent.charge((count + transition_cost) * classes.count());
+
+                if (states.size() > max_states || spent.exceeded())
+                {
+                    result.valid = false;
+                    return result;
+                }
+
+                bool accepting = false;
+                for (const auto position: positions)
+                {
+                    accepting = accepting || initial[position + 1];
+                }
+                result.accepting.push_back(accepting);
+
+                for (const auto c: classes.representative)
+                {
+                    auto*      marked     = buffers.marks.data();
+                    const auto generation = ++buffers.generation;
+
+                    for (const auto position: positions)
+                    {
+                        const auto& before = predecessors[position + 1];
+                        spent.charge(before.size());
+
+                        for (const auto p: before)
+                        {
+                            if (automaton.positions[p].bytes.contains(c))
+                            {
+                                marked[p] = generation;
+                            }
+                        }
+                    }
+
+                    auto*    previous = buffers.list.data();
+                    unsigned size     = 0;
+
+                    for (unsigned p = 0; p < count; ++p)
+                    {
+                        if (marked[p] == generation)
+                        {
+                            previous[size++] = static_cast<item>(p);
+                        }
+                    }
+
+                    result.next.push_back(
+                        states.intern(previous, size, spent));
+                }
+            }
+
+            result.valid = !spent.exceeded();
+
+            return result;
+        }
+
+        // Moore's algorithm: merges states with the same future
+        constexpr auto minimize(const table& automaton, cost& spent)
+            -> table
+        {
+            if (!automaton.valid)
+            {
+                return automaton;
+            }
+
+            const auto states = automaton.states();
+
+            std::vector<unsigned> block(states);
+            for (unsigned s = 0; s < states; ++s)
+            {
+                block[s] = automaton.accepting[s] ? 1 : 0;
+            }
+
+            // A state is told apart by its block and the blocks it moves
+            // to. Signatures are stored flat and compared as raw ranges:
+            // nested vectors and iterators are slow during constant
+            // evaluation, and long counted repetitions need many rounds
+            const auto            width = automaton.classes + 1;
+            std::vector<unsigned> signatures(states * width);
+            std::vector<unsigned> order(states);
+            std::vector<unsigned> sorted(states);
+
+            // Block indices are below states + 1
+            std::vector<unsigned> counts(states + 2);
+
+            const auto compare = [&](unsigned a, unsigned b) {
+                const auto* left  = signatures.data() + a * width;
+                const auto* right = signatures.data() + b * width;
+
+                for (unsigned k = 0; k < width; ++k)
+                {
+                    if (left[k] != right[k])
+                    {
+                        return left[k] < right[k] ? -1 : 1;
+                    }
+                }
+
+                return 0;
+            };
+
+            for (unsigned blocks = 0;;)
+            {
+                // Signatures are filled, sorted and grouped
+                spent.charge(3 * states * width);
+
+                if (spent.exceeded())
+                {
+                    auto result  = automaton;
+                    result.valid = false;
+
+                    return result;
+                }
+
+                auto*       signature = signatures.data();
+                auto*       blocks_of = block.data();
+                const auto* next      = automaton.next.data();
+
+                for (unsigned s = 0; s < states; ++s)
+                {
+                    signature[s * width] = blocks_of[s];
+
+                    for (unsigned c = 0; c < automaton.classes; ++c)
+                    {
+                        signature[s * width + c + 1]
+                            = blocks_of[next[s * automaton.classes + c]];
+                    }
+                }
+
+                // Sorting gathers the states with the same signature: a
+                // stable counting sort per column, from the last one,
+                // as comparison sorts are slow during constant
+                // evaluation
+                std::iota(order.begin(), order.end(), 0U);
+
+                for (auto k = width; k-- > 0;)
+                {
+                    auto*       count = counts.data();
+                    const auto* from  = order.data();
+                    auto*       to    = sorted.data();
+
+                    for (unsigned i = 0; i <= states + 1; ++i)
+                    {
+                        count[i] = 0;
+                    }
+
+                    for (unsigned i = 0; i < states; ++i)
+                    {
+                        ++count[signature[from[i] * width + k] + 1];
+                    }
+
+                    for (unsigned i = 1; i <= states + 1; ++i)
+                    {
+                        count[i] += count[i - 1];
+                    }
+
+                    for (unsigned i = 0; i < states; ++i)
+                    {
+                        to[count[signature[from[i] * width + k]]++] = from[i];
+                    }
+
+                    order.swap(sorted);
+                }
+
+                const auto* ranked = order.data();
+
+                unsigned found = 0;
+
+                // The dead and the start state keep their index
+                unsigned next_index = 2;
+
+                for (unsigned i = 0; i < states; ++found)
+                {
+                    auto j     = i;
+                    auto index = next_index;
+
+                    for (; j < states && compare(ranked[j], ranked[i]) == 0;
+                         ++j)
+                    {
+                        if (ranked[j] == dead)
+                        {
+                            index = dead;
+                        }
+                        else if (ranked[j] == start && index != dead)
+                        {
+                            index = start;
+                        }
+                    }
+
+                    next_index += index == next_index ? 1 : 0;
+
+                    for (; i < j; ++i)
+                    {
+                        blocks_of[ranked[i]] = index;
+                    }
+                }
+
+                if (found == blocks)
+                {
+                    break;
+                }
+
+                blocks = found;
+            }
+
+            table result;
+            result.classes = automaton.classes;
+
+            // The start state has a row even if it was merged with the
+            // dead one
+            const auto blocks = std::max(
+                *std::max_element(block.begin(), block.end()) + 1, 2U);
+            result.accepting.resize(blocks);
+            result.next.resize(blocks * automaton.classes);
+
+            for (unsigned s = 0; s < states; ++s)
+            {
+                result.accepting[block[s]] = automaton.accepting[s];
+
+                for (unsigned c = 0; c < automaton.classes; ++c)
+                {
+                    result.next[block[s] * automaton.classes + c]
+                        = block[automaton.next[s * automaton.classes + c]];
+                }
+            }
+
+            return result;
+        }
+
+        // The forward and the reverse automaton of node
+        template<typename node>
+        constexpr auto build() -> std::array<table, 2>
+        {
+            const auto automaton = make_position_automaton<node>();
+            const auto classes   = partition<node>();
+
+            cost       spent;
+            const auto ahead = minimize(forward(automaton, classes, spent), spent);
+
+            // Too many states already, the reverse one is not needed
+            if (!ahead.valid)
+            {
+                return std::array<table, 2> {ahead, ahead};
+            }
+
+            return std::array<table, 2> {
+                ahead, minimize(reverse(automaton, classes, spent), spent)};
+        }
+
+        // Transition table with a row of classes per state
+        template<unsigned states, unsigned classes>
+        struct rows
+        {
+                std::array<std::array<std::uint8_t, classes>, states> next
+                    = {};
+                std::array<bool, states> accepting = {};
+
+                constexpr void fill(const table& built) noexcept
+                {
+                    for (unsigned s = 0; s < states; ++s)
+                    {
+                        accepting[s] = built.accepting[s];
+
+                        for (unsigned c = 0; c < classes; ++c)
+                        {
+                            next[s][c] = static_cast<std::uint8_t>(
+                                built.next[s * classes + c]);
+                        }
+                    }
+                }
+        };
+
+        /*
+         * Literal every match ends with, whose first byte no other
+         * position reads: it can only occur in a match at its end.
+         * Empty if there is none.
+         */
+        template<typename node>
+        constexpr auto unique_suffix() -> analysis::literal
+        {
+            const auto  automaton = make_position_automaton<node>();
+            const auto& positions = automaton.positions;
+
+            const auto is_single = [](const std::vector<item>& list,
+                                      item                     value) {
+                return list.size() == 1 && list[0] == value;
+            };
+
+            // Positions leading to item, and whether the match can
+            // start with it
+            const auto predecessors = [&](item value) {
+                std::vector<item> result;
+
+                for (unsigned p = 0; p < positions.size(); ++p)
+                {
+                    const auto& follow = positions[p].follow;
+
+                    if (std::find(follow.begin(), follow.end(), value)
+                        != follow.end())
+                    {
+                        result.push_back(static_cast<item>(p));
+                    }
+                }
+
+                return result;
+            };
+
+            // The last bytes read before accepting, in reverse
+            std::vector<item> chain;
+            auto              before = predecessors(accept);
+
+            if (std::find(automaton.first.begin(),
+                          automaton.first.end(),
+                          accept)
+                == automaton.first.end())
+            {
+                while (before.size() == 1
+                       && chain.size() < analysis::max_literal_size)
+                {
+                    const auto  p        = before[0];
+                    const auto& position = positions[p];
+
+                    if (position.bytes.size() != 1
+                        || !is_single(position.follow,
+                                      chain.empty() ? accept : chain.back()))
+                    {
+                        break;
+                    }
+
+                    chain.push_back(p);
+
+                    if (std::find(automaton.first.begin(),
+                                  automaton.first.end(),
+                                  p)
+                        != automaton.first.end())
+                    {
+                        break;
+                    }
+
+                    before = predecessors(p);
+                }
+            }
+
+            // The longest tail of the chain starting with a byte only
+            // its first position reads
+            for (auto k = chain.size(); k > 0; --k)
+            {
+                const auto head = positions[chain[k - 1]].bytes.at(0);
+                bool       unique = true;
+
+                for (unsigned p = 0; p < positions.size(); ++p)
+                {
+                    if (static_cast<item>(p) != chain[k - 1]
+                        && positions[p].bytes.contains(head))
+                    {
+                        unique = false;
+                    }
+                }
+
+                if (unique)
+                {
+                    analysis::literal result;
+
+                    for (auto i = k; i > 0; --i)
+                    {
+                        result = result.push_back(static_cast<char>(
+                            positions[chain[i - 1]].bytes.at(0)));
+                    }
+
+                    return result;
+                }
+            }
+
+            return {};
+        }
+
+        /*
+         * Cost of building the automata of node if they had a state
+         * per position, as most have: regexes over the budget even
+         * then are not tried
+         */
+        template<typename node>
+        inline constexpr auto estimated_cost
+            = std::size_t {position_count<node>} * class_map<node>.count
+              * (position_count<node> + transition_cost);
+
+        template<typename node>
+        inline constexpr auto sizes = [] {
+            const auto built = build<node>();
+
+            return std::array<unsigned, 2> {
+                built[0].valid ? built[0].states() : 0U,
+                built[1].valid ? built[1].states() : 0U};
+        }();
+
+        template<typename node,
+                 unsigned forward_states,
+                 unsigned reverse_states>
+        inline constexpr auto tables = [] {
+            constexpr auto classes = class_map<node>.count;
+
+            struct
+            {
+                    rows<forward_states, classes> forward;
+                    rows<reverse_states, classes> reverse;
+            } result;
+
+            if constexpr (forward_states > 0 && reverse_states > 0)
+            {
+                const auto built = build<node>();
+                result.forward.fill(built[0]);
+                result.reverse.fill(built[1]);
+            }
+
+            return result;
+        }();
+    } // namespace __private
+
+    /*
+     * Deterministic automata of an expression, built at compile
+     * time. Only expressions whose backtracking match is the
+     * leftmost-first match and without capture groups are
+     * supported: the match end is found running forward, its start
+     * running backwards from the end. Expressions whose automata
+     * cost more than max_construction_cost to build are not.
+     */
+    template<typename matcher>
+    struct dfa
+    {
+        private:
+            static constexpr bool supported = [] {
+                if constexpr (nodes::group_getter<matcher>::value == 0
+                              && analysis::matches_leftmost_first<matcher>
+                              && position_count<matcher> <= max_positions)
+                {
+                    return __private::estimated_cost<matcher>
+                           <= max_construction_cost;
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+            static constexpr auto sizes = [] {
+                if constexpr (supported)
+                {
+                    return __private::sizes<matcher>;
+                }
+                else
+                {
+                    return std::array<unsigned, 2> {};
+                }
+            }();
+
+            static constexpr auto& tables
+                = __private::tables<matcher, sizes[0], sizes[1]>;
+
+            using searcher = search::searcher<matcher>;
+
+        public:
+            // Literal ending every match, and only found at its end
+            static constexpr auto suffix = [] {
+                if constexpr (supported)
+                {
+                    return __private::unique_suffix<matcher>();
+                }
+                else
+                {
+                    return analysis::literal {};
+                }
+            }();
+
+            // Unless a literal prefix guides the forward search
+            static constexpr bool reverse_suffix
+                = suffix.size > 0 && !search::literal_prefix<matcher>::enabled
+                  && !search::teddy<matcher>::enabled;
+
+        private:
+            /*
+             * Finds each occurrence of the suffix, and runs the reverse
+             * automaton from its end. A match can contain the suffix
+             * only at its end, so the earliest start found is the
+             * leftmost match, and matches ending at the next
+             * occurrence start after this one.
+             */
+            static constexpr __attribute__((always_inline)) auto
+                find_reverse(const char*  begin,
+                             const char*  end,
+                             const char*& match_begin,
+                             const char*& match_end) noexcept -> bool
+            {
+                constexpr auto& backward = tables.reverse;
+                constexpr auto& class_of = class_map<matcher>.class_of;
+
+                for (const auto* lower = begin;;)
+                {
+                    const auto* hit
+                        = search::find_substring<suffix>(lower, end);
+
+                    if (hit == end)
+                    {
+                        return false;
+                    }
+
+                    const char* found = nullptr;
+                    auto        state = start;
+
+                    for (const auto* current = hit + suffix.size;
+                         current > lower;)
+                    {
+                        --current;
+
+                        const auto c = static_cast<unsigned char>(*current);
+                        state        = backward.next[state][class_of[c]];
+
+                        if (state == dead)
+                        {
+                            break;
+                        }
+
+                        if (backward.accepting[state])
+                        {
+                            found = current;
+                        }
+                    }
+
+                    if (found != nullptr)
+                    {
+                        match_begin = found;
+                        match_end   = hit + suffix.size;
+
+                        return true;
+                    }
+
+                    lower = hit + 1;
+                }
+            }
+
+        public:
+            static constexpr bool enabled
+                = sizes[0] > 0 && sizes[1] > 0;
+
+            /**
+             * @brief Finds the first match in [begin, end)
+             *
+             * @return false if there is none, otherwise the match is
+             * stored in match_begin and match_end
+             */
+            static constexpr __attribute__((always_inline)) auto
+                find(const char*                begin,
+                     const char*                end,
+                     typename searcher::state&  search_state,
+                     const char*&               match_begin,
+                     const char*&               match_end) noexcept -> bool
+            {
+                if constexpr (reverse_suffix)
+                {
+                    return find_reverse(begin, end, match_begin, match_end);
+                }
+
+                constexpr auto& forward  = tables.forward;
+                constexpr auto& class_of = class_map<matcher>.class_of;
+
+                const char* found = nullptr;
+                auto        state = start;
+
+                for (const auto* current = begin; current < end;)
+                {
+                    if (state == start && found == nullptr)
+                    {
+                        // No thread is alive, skip to the next
+                        // candidate
+                        current = searcher::find(current, end, search_state);
+
+                        if (current >= end)
+                        {
+                            break;
+                        }
+                    }
+
+                    const auto c = static_cast<unsigned char>(*current);
+                    state        = forward.next[state][class_of[c]];
+                    ++current;
+
+                    if (state == dead)
+                    {
+                        break;
+                    }
+
+                    if (forward.accepting[state])
+                    {
+                        found = current;
+                    }
+                }
+
+                if (found == nullptr)
+                {
+                    return false;
+                }
+
+                match_begin = leftmost_start(begin, found);
+                match_end   = found;
+
+                return true;
+            }
+
+            /**
+             * @brief Leftmost start in [begin, match_end) of a match
+             * ending at match_end, running the reverse automaton
+             *
+             * @return match_end if there is none
+             */
+            static constexpr __attribute__((always_inline)) auto
+                leftmost_start(const char* begin,
+                               const char* match_end) noexcept -> const char*
+            {
+                constexpr auto& backward = tables.reverse;
+                constexpr auto& class_of = class_map<matcher>.class_of;
+
+                const auto* result = match_end;
+                auto        state  = start;
+
+                for (const auto* current = match_end; current > begin;)
+                {
+                    --current;
+
+                    const auto c = static_cast<unsigned char>(*current);
+                    state        = backward.next[state][class_of[c]];
+
+                    if (state == dead)
+                    {
+                        break;
+                    }
+
+                    if (backward.accepting[state])
+                    {
+                        result = current;
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief True if a match ends in [begin, end), stopping at
+             * the first one without looking for its bounds
+             */
+            static constexpr __attribute__((always_inline)) auto
+                contains(const char*               begin,
+                         const char*               end,
+                         typename searcher::state& search_state) noexcept
+                -> bool
+            {
+                constexpr auto& forward  = tables.forward;
+                constexpr auto& class_of = class_map<matcher>.class_of;
+
+                auto state = start;
+
+                for (const auto* current = begin; current < end;)
+                {
+                    if (state == start)
+                    {
+                        current = searcher::find(current, end, search_state);
+
+                        if (current >= end)
+                        {
+                            break;
+                        }
+                    }
+
+                    const auto c = static_cast<unsigned char>(*current);
+                    state        = forward.next[state][class_of[c]];
+                    ++current;
+
+                    if (state == dead)
+                    {
+                        break;
+                    }
+
+                    if (forward.accepting[state])
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+    };
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_DFA_HPP_*/
@@ -0,0 +1,538 @@
+#ifndef E_REGEX_AUTOMATA_LAZY_DFA_HPP_
+#define E_REGEX_AUTOMATA_LAZY_DFA_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "analysis/leftmost_first.hpp"
+#include "byte_classes.hpp"
+#include "dfa.hpp"
+#include "nfa.hpp"
+#include "nodes/common.hpp"
+#include "search/searcher.hpp"
+
+namespace e_regex::automata
+{
+    // Largest automata simulated by the lazy DFA
+    inline constexpr auto max_lazy_positions = 1024U;
+
+    // A cache filling up faster than this is not worth flushing
+    inline constexpr auto min_bytes_per_state = 10U;
+
+    struct cache_statistics
+    {
+            // Transitions found in the cache
+            std::size_t hits = 0;
+
+            // Transitions computed from the automaton
+            std::size_t misses = 0;
+
+            // Times the cache was cleared to make room
+            std::size_t flushes = 0;
+
+            // Searches given back to the regex tree because the cache
+            // was thrashing
+            std::size_t fallbacks = 0;
+    };
+
+    enum class lazy_result
+    {
+        found,
+        not_found,
+        gave_up
+    };
+
+    /*
+     * DFA built while matching: states are computed on demand from
+     * the nfa of the expression and kept in a cache of cache_states
+     * entries per thread, cleared when full. It supports the same
+     * expressions as dfa, without limits on the number of states.
+     */
+    template<typename matcher, unsigned cache_states>
+    class lazy_dfa
+    {
+            static_assert(cache_states > 2 && cache_states < 0xFFFF,
+                          "A lazy DFA needs at least 3 cached states");
+
+            using nfa      = automata::nfa<matcher>;
+            using index    = std::uint16_t;
+            using searcher = search::searcher<matcher>;
+
+            static constexpr auto  positions = position_count<matcher>;
+            static constexpr auto& classes   = class_map<matcher>;
+
+            // Items are stored as in nfa: accept, then positions, then
+            // restart
+            static constexpr index accept_item  = 0;
+            static constexpr index restart_item = positions + 1;
+
+            struct thread_list
+            {
+                    std::array<index, positions + 2> items;
+                    unsigned                              size = 0;
+
+                    constexpr void push(index item) noexcept
+                    {
+                        items[size++] = item;
+                    }
+
+                    constexpr auto
+                        operator==(const thread_list& other) const noexcept
+                        -> bool
+                    {
+                        if (size != other.size)
+                        {
+                            return false;
+                        }
+
+                        for (unsigned i = 0; i < size; ++i)
+                        {
+                            if (items[i] != other.items[i])
+                            {
+                                return false;
+                            }
+                        }
+
+                        return true;
+                    }
+            };
+
+            // Ordered threads of a leftmost-first search, as in dfa
+            struct forward
+            {
+                    static constexpr auto initial() noexcept -> thread_list
+                    {
+                        thread_list result;
+
+                        for (const auto item: nfa::data.first)
+                        {
+                            result.push(item);
+                        }
+                        result.push(restart_item);
+
+                        return result;
+                    }
+
+                    static constexpr void step(const thread_list& threads,
+                                               unsigned char      c,
+                                               thread_list& result) noexcept
+                    {
+                        constexpr auto& data = nfa::data;
+
+                        std::array<bool, positions + 2> seen = {};
+
+                        // Threads after an accepting one are dropped
+                        auto add = [&](index item) {
+                            if (!seen[item] && !seen[accept_item])
+                            {
+                                seen[item] = true;
+                                result.push(item);
+                            }
+                        };
+
+                        for (unsigned i = 0;
+                             i < threads.size && !seen[accept_item];
+                             ++i)
+                        {
+                            const auto item = threads.items[i];
+
+                            if (item == restart_item)
+                            {
+                                for (const auto first: data.first)
+                                {
+                                    add(first);
+                                }
+                                add(restart_item);
+                            }
+                            else if (item != accept_item
+                                     && data.bytes[item - 1].contains(c))
+                            {
+                                for (auto f = data.follow_begin[item - 1];
+                                     f < data.follow_begin[item]
+                                     && !seen[accept_item];
+                                     ++f)
+                                {
+                                    add(data.follow[f]);
+                                }
+                            }
+                        }
+                    }
+
+                    static constexpr auto
+                        accepting(const thread_list& threads) noexcept
+                        -> bool
+                    {
+                        return threads.size > 0
+                               && threads.items[threads.size - 1]
+                                      == accept_item;
+                    }
+            };
+
+            // Sets of positions that can have consumed the last byte
+            // read, running backwards from the end of a match
+            struct reverse
+            {
+                    static constexpr auto initial() noexcept -> thread_list
+                    {
+                        thread_list result;
+                        result.push(accept_item);
+
+                        return result;
+                    }
+
+                    static constexpr void step(const thread_list& set,
+                                               unsigned char      c,
+                                               thread_list& result) noexcept
+                    {
+                        constexpr auto& data = nfa::data;
+
+                        std::array<bool, positions + 1> marked = {};
+
+                        for (unsigned i = 0; i < set.size; ++i)
+                        {
+                            const auto item = set.items[i];
+
+                            for (auto p = data.predecessors_begin[item];
+                                 p < data.predecessors_begin[item + 1];
+                                 ++p)
+                            {
+                                const auto previous = data.predecessors[p];
+
+                                marked[previous]
+                                    = data.bytes[previous - 1].contains(c);
+                            }
+                        }
+
+                        for (index item = 1; item <= positions; ++item)
+                        {
+                            if (marked[item])
+                            {
+                                result.push(item);
+                            }
+                        }
+                    }
+
+                    static constexpr auto
+                        accepting(const thread_list& set) noexcept -> bool
+                    {
+                        for (unsigned i = 0; i < set.size; ++i)
+                        {
+                            const auto item = set.items[i];
+
+                            if (item != accept_item
+                                && nfa::data.first_position[item - 1])
+                            {
+                                return true;
+                            }
+                        }
+
+                        return false;
+                    }
+            };
+
+            template<typename direction>
+            struct cache
+            {
+                    static constexpr index unknown
+                        = std::numeric_limits<index>::max();
+
+                    // Transitions, keyed by byte class
+                    using row = std::array<index, classes.count>;
+
+                    std::array<row, cache_states>         next;
+                    std::array<thread_list, cache_states> lists;
+                    std::array<bool, cache_states>        accepting;
+                    unsigned                              size;
+
+                    // Bytes read since the last flush
+                    std::size_t scanned = 0;
+
+                    cache_statistics statistics;
+
+                    cache() noexcept
+                    {
+                        clear();
+                    }
+
+                    // Only the dead and the start state are kept
+                    void clear() noexcept
+                    {
+                        size = 0;
+                        add(thread_list {});
+                        add(direction::initial());
+                        scanned = 0;
+                    }
+
+                    auto add(const thread_list& list) noexcept -> index
+                    {
+                        lists[size]     = list;
+                        accepting[size] = direction::accepting(list);
+                        next[size].fill(unknown);
+
+                        return size++;
+                    }
+
+                    auto find(const thread_list& list) const noexcept
+                        -> index
+                    {
+                        for (index state = 0; state < size; ++state)
+                        {
+                            if (lists[state] == list)
+                            {
+                                return state;
+                            }
+                        }
+
+                        return unknown;
+                    }
+
+                    /*
+                     * Computes a missing transition. When the cache is
+                     * full it is flushed, unless it filled up too fast:
+                     * then unknown is returned and the search should
+                     * give up.
+                     */
+                    auto miss(index         state,
+                              unsigned char c,
+                              std::size_t   read) noexcept -> index
+                    {
+                        ++statistics.misses;
+
+                        thread_list target;
+                        direction::step(lists[state], c, target);
+
+                        auto result = find(target);
+
+                        if (result == unknown)
+                        {
+                            if (size == cache_states)
+                            {
+                                if (scanned + read
+                                    < min_bytes_per_state * cache_states)
+                                {
+                                    ++statistics.fallbacks;
+                                    return unknown;
+                                }
+
+                                ++statistics.flushes;
+                                clear();
+
+                                return add(target);
+                            }
+
+                            result = add(target);
+                        }
+
+                        next[state][classes.class_of[c]] = result;
+
+                        return result;
+                    }
+            };
+
+            static auto forward_cache() noexcept -> cache<forward>&
+            {
+                thread_local cache<forward> instance;
+
+                return instance;
+            }
+
+            static auto reverse_cache() noexcept -> cache<reverse>&
+            {
+                thread_local cache<reverse> instance;
+
+                return instance;
+            }
+
+            // Finds where the leftmost-first match starting from begin
+            // ends
+            static auto find_end(const char*               begin,
+                                 const char*               end,
+                                 typename searcher::state& search_state,
+                                 const char*& match_end) noexcept
+                -> lazy_result
+            {
+                auto& cache = forward_cache();
+
+                const char* found   = nullptr;
+                const char* current = begin;
+                const char* segment = begin;
+                std::size_t steps   = 0;
+                index       state   = start;
+                auto        result  = lazy_result::not_found;
+
+                while (current < end)
+                {
+                    if (state == start && found == nullptr)
+                    {
+                        cache.scanned += current - segment;
+                        current = searcher::find(current, end, search_state);
+                        segment = current;
+
+                        if (current >= end)
+                        {
+                            break;
+                        }
+                    }
+
+                    const auto c = static_cast<unsigned char>(*current);
+                    auto next    = cache.next[state][classes.class_of[c]];
+
+                    if (next == cache.unknown)
+                    {
+                        const auto flushes = cache.statistics.flushes;
+                        next = cache.miss(state, c, current - segment);
+
+                        if (next == cache.unknown)
+                        {
+                            result = lazy_result::gave_up;
+                            break;
+                        }
+
+                        if (cache.statistics.flushes != flushes)
+                        {
+                            segment = current;
+                        }
+                    }
+                    else
+                    {
+                        ++steps;
+                    }
+
+                    state = next;
+                    ++current;
+
+                    if (state == dead)
+                    {
+                        break;
+                    }
+
+                    if (cache.accepting[state])
+                    {
+                        found = current;
+                    }
+                }
+
+                cache.statistics.hits += steps;
+                cache.scanned += current - segment;
+
+                if (result == lazy_result::gave_up)
+                {
+                    return result;
+                }
+
+                match_end = found;
+                return found == nullptr ? lazy_result::not_found
+                                        : lazy_result::found;
+            }
+
+            // Finds where the match ending in match_end starts
+            static auto find_begin(const char* begin,
+                                   const char* match_end,
+                                   const char*& match_begin) noexcept
+                -> lazy_result
+            {
+                auto& cache = reverse_cache();
+
+                const char* segment = match_end;
+                std::size_t steps   = 0;
+                index       state   = start;
+
+                match_begin = match_end;
+
+                for (const auto* current = match_end; current > begin;)
+                {
+                    --current;
+
+                    const auto c = static_cast<unsigned char>(*current);
+                    auto next    = cache.next[state][classes.class_of[c]];
+
+                    if (next == cache.unknown)
+                    {
+                        const auto flushes = cache.statistics.flushes;
+                        next = cache.miss(state, c, segment - current);
+
+                        if (next == cache.unknown)
+                        {
+                            cache.statistics.hits += steps;
+                            return lazy_result::gave_up;
+                        }
+
+                        if (cache.statistics.flushes != flushes)
+                        {
+                            segment = current;
+                        }
+                    }
+                    else
+                    {
+                        ++steps;
+                    }
+
+                    state = next;
+
+                    if (state == dead)
+                    {
+                        break;
+                    }
+
+                    if (cache.accepting[state])
+                    {
+                        match_begin = current;
+                    }
+                }
+
+                cache.statistics.hits += steps;
+                cache.scanned += segment - match_begin;
+
+                return lazy_result::found;
+            }
+
+        public:
+            static constexpr bool enabled
+                = nodes::group_getter<matcher>::value == 0
+                  && analysis::matches_leftmost_first<matcher>
+                  && position_count<matcher> <= max_lazy_positions;
+
+            /**
+             * @brief Finds the first match in [begin, end)
+             *
+             * @return gave_up if the cache was thrashing: the search
+             * must be done in another way
+             */
+            static auto find(const char*               begin,
+                             const char*               end,
+                             typename searcher::state& search_state,
+                             const char*&              match_begin,
+                             const char*& match_end) noexcept -> lazy_result
+            {
+                const auto result
+                    = find_end(begin, end, search_state, match_end);
+
+                if (result != lazy_result::found)
+                {
+                    return result;
+                }
+
+                return find_begin(begin, match_end, match_begin);
+            }
+
+            /**
+             * @brief Counters of the caches of the calling thread
+             */
+            static auto statistics() noexcept -> cache_statistics
+            {
+                const auto& forward = forward_cache().statistics;
+                const auto& reverse = reverse_cache().statistics;
+
+                return cache_statistics {
+                    .hits      = forward.hits + reverse.hits,
+                    .misses    = forward.misses + reverse.misses,
+                    .flushes   = forward.flushes + reverse.flushes,
+                    .fallbacks = forward.fallbacks + reverse.fallbacks,
+                };
+            }
+    };
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_LAZY_DFA_HPP_*/
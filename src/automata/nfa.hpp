@@ -0,0 +1,106 @@
+#ifndef E_REGEX_AUTOMATA_NFA_HPP_
+#define E_REGEX_AUTOMATA_NFA_HPP_
+
+#include <array>
+#include <cstdint>
+
+#include "position_automaton.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::automata
+{
+    /*
+     * Position automaton of node flattened in static arrays, to be
+     * simulated at runtime. Items are stored shifted by one, so that
+     * accept is 0 and position p is p + 1.
+     */
+    template<typename node>
+    struct nfa
+    {
+            using index = std::uint16_t;
+
+            static constexpr unsigned positions = position_count<node>;
+
+        private:
+            static constexpr auto lengths = [] {
+                const auto automaton = make_position_automaton<node>();
+
+                std::array<unsigned, 2> result {
+                    static_cast<unsigned>(automaton.first.size()), 0};
+
+                for (const auto& position: automaton.positions)
+                {
+                    result[1] += position.follow.size();
+                }
+
+                return result;
+            }();
+
+        public:
+            struct tables
+            {
+                    std::array<byte_set, positions> bytes = {};
+                    std::array<bool, positions>     first_position = {};
+
+                    std::array<index, lengths[0]> first = {};
+
+                    // Items following position p are
+                    // follow[follow_begin[p], follow_begin[p + 1])
+                    std::array<index, positions + 1> follow_begin = {};
+                    std::array<index, lengths[1]>    follow       = {};
+
+                    // Positions followed by item i are
+                    // predecessors[predecessors_begin[i],
+                    //              predecessors_begin[i + 1])
+                    std::array<index, positions + 2> predecessors_begin
+                        = {};
+                    std::array<index, lengths[1]> predecessors = {};
+            };
+
+            static constexpr auto data = [] {
+                const auto automaton = make_position_automaton<node>();
+
+                tables result;
+
+                for (unsigned i = 0; i < automaton.first.size(); ++i)
+                {
+                    result.first[i] = automaton.first[i] + 1;
+                    result.first_position[automaton.first[i]] = true;
+                }
+
+                unsigned follow = 0;
+                for (unsigned p = 0; p < positions; ++p)
+                {
+                    result.bytes[p]        = automaton.positions[p].bytes;
+                    result.follow_begin[p] = follow;
+
+                    for (const auto next: automaton.positions[p].follow)
+                    {
+                        result.follow[follow++] = next + 1;
+                        ++result.predecessors_begin[next + 2];
+                    }
+                }
+                result.follow_begin[positions] = follow;
+
+                // Counts to offsets, then fill
+                for (unsigned i = 1; i < positions + 2; ++i)
+                {
+                    result.predecessors_begin[i]
+                        += result.predecessors_begin[i - 1];
+                }
+
+                auto cursor = result.predecessors_begin;
+                for (unsigned p = 0; p < positions; ++p)
+                {
+                    for (const auto next: automaton.positions[p].follow)
+                    {
+                        result.predecessors[cursor[next + 1]++] = p + 1;
+                    }
+                }
+
+                return result;
+            }();
+    };
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_NFA_HPP_*/
@@ -0,0 +1,578 @@
+#ifndef E_REGEX_AUTOMATA_ONE_PASS_HPP_
+#define E_REGEX_AUTOMATA_ONE_PASS_HPP_
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "analysis/anchors.hpp"
+#include "byte_classes.hpp"
+#include "dfa.hpp"
+#include "nodes/common.hpp"
+#include "position_automaton.hpp"
+#include "utilities/literal_string_view.hpp"
+
+namespace e_regex::automata
+{
+    enum class one_pass_result
+    {
+        found,
+        not_found,
+
+        // The match needs backtracking to an earlier end, the regex
+        // tree has to be run
+        ambiguous
+    };
+
+    namespace __private
+    {
+        // Group index * 2, plus 1 when the group opens
+        using tag = std::uint16_t;
+
+        constexpr auto open_tag(unsigned group) -> tag
+        {
+            return static_cast<tag>(group * 2 + 1);
+        }
+
+        constexpr auto close_tag(unsigned group) -> tag
+        {
+            return static_cast<tag>(group * 2);
+        }
+
+        // An item reached after the group boundaries in tags, in order
+        struct tagged_item
+        {
+                item             target;
+                std::vector<tag> tags;
+        };
+
+        using tagged_list = std::vector<tagged_item>;
+
+        constexpr void append_unique(tagged_list&       list,
+                                     const tagged_list& items)
+        {
+            for (const auto& i: items)
+            {
+                bool known = false;
+
+                for (const auto& other: list)
+                {
+                    known = known || other.target == i.target;
+                }
+
+                if (!known)
+                {
+                    list.push_back(i);
+                }
+            }
+        }
+
+        constexpr auto prepend(tag t, tagged_list list) -> tagged_list
+        {
+            for (auto& i: list)
+            {
+                i.tags.insert(i.tags.begin(), t);
+            }
+
+            return list;
+        }
+
+        // Position automaton builder keeping track of group boundaries
+        struct tagged_builder
+        {
+                std::vector<byte_set>    bytes;
+                std::vector<tagged_list> follow;
+                std::vector<tagged_list> loops;
+
+                constexpr auto add(const byte_set&    set,
+                                   const tagged_list& next) -> tagged_list
+                {
+                    bytes.push_back(set);
+                    follow.push_back(next);
+
+                    return {{static_cast<item>(bytes.size() - 1), {}}};
+                }
+
+                constexpr void resolve(const tagged_list&      list,
+                                       const std::vector<tag>& before,
+                                       tagged_list&            result,
+                                       std::vector<bool>& expanding) const
+                {
+                    for (const auto& i: list)
+                    {
+                        auto tags = before;
+                        tags.insert(tags.end(), i.tags.begin(), i.tags.end());
+
+                        if (i.target >= accept)
+                        {
+                            append_unique(result, {{i.target, tags}});
+                        }
+                        else if (!expanding[builder::loop_of(i.target)])
+                        {
+                            const auto loop = builder::loop_of(i.target);
+
+                            expanding[loop] = true;
+                            resolve(loops[loop], tags, result, expanding);
+                            expanding[loop] = false;
+                        }
+                    }
+                }
+
+                constexpr auto resolve(const tagged_list& list) const
+                    -> tagged_list
+                {
+                    tagged_list       result;
+                    std::vector<bool> expanding(loops.size(), false);
+                    resolve(list, {}, result, expanding);
+
+                    return result;
+                }
+        };
+
+        template<typename node>
+        constexpr auto enter_tagged(tagged_builder&    builder,
+                                    const tagged_list& continuation)
+            -> tagged_list;
+
+        template<typename... children>
+        constexpr auto enter_tagged_children(tagged_builder&    builder,
+                                             const tagged_list& continuation,
+                                             std::tuple<children...>*)
+            -> tagged_list
+        {
+            if constexpr (sizeof...(children) == 0)
+            {
+                return continuation;
+            }
+            else
+            {
+                tagged_list result;
+                (append_unique(result,
+                               enter_tagged<children>(builder, continuation)),
+                 ...);
+
+                return result;
+            }
+        }
+
+        // Same unrolling as enter_repetition
+        template<typename traits>
+        constexpr auto
+            enter_tagged_repetition(tagged_builder&    builder,
+                                    const tagged_list& continuation)
+                -> tagged_list
+        {
+            using head = typename traits::head;
+
+            const auto after = enter_tagged_children(
+                builder,
+                continuation,
+                static_cast<typename traits::children*>(nullptr));
+            constexpr bool lazy = traits::policy_ == policy::LAZY;
+
+            auto choice = [&](const tagged_list& iteration) {
+                tagged_list result;
+                append_unique(result, lazy ? after : iteration);
+                append_unique(result, lazy ? iteration : after);
+
+                return result;
+            };
+
+            auto result = after;
+
+            if constexpr (traits::maximum == analysis::unbounded)
+            {
+                const auto loop = static_cast<unsigned>(builder.loops.size());
+                builder.loops.emplace_back();
+
+                const auto iteration = enter_tagged<head>(
+                    builder, {{builder::loop_item(loop), {}}});
+                builder.loops[loop] = choice(iteration);
+                result = {{builder::loop_item(loop), {}}};
+            }
+            else
+            {
+                for (unsigned i = traits::minimum; i < traits::maximum; ++i)
+                {
+                    result = choice(enter_tagged<head>(builder, result));
+                }
+            }
+
+            for (unsigned i = 0; i < traits::minimum; ++i)
+            {
+                result = enter_tagged<head>(builder, result);
+            }
+
+            return result;
+        }
+
+        template<typename node>
+        constexpr auto enter_tagged(tagged_builder&    builder,
+                                    const tagged_list& continuation)
+            -> tagged_list
+        {
+            using traits = analysis::node_traits<node>;
+
+            if constexpr (traits::kind == analysis::node_kind::bytes)
+            {
+                return builder.add(traits::bytes, continuation);
+            }
+            else if constexpr (traits::kind == analysis::node_kind::literal)
+            {
+                auto result = continuation;
+
+                for (auto i = traits::literal.size(); i > 0; --i)
+                {
+                    byte_set bytes;
+                    bytes.insert(
+                        static_cast<unsigned char>(traits::literal[i - 1]));
+
+                    result = builder.add(bytes, result);
+                }
+
+                return result;
+            }
+            else if constexpr (traits::kind
+                               == analysis::node_kind::alternation)
+            {
+                return enter_tagged_children(
+                    builder,
+                    continuation,
+                    static_cast<typename traits::children*>(nullptr));
+            }
+            else if constexpr (traits::kind
+                               == analysis::node_kind::repetition)
+            {
+                return enter_tagged_repetition<traits>(builder, continuation);
+            }
+            else if constexpr (traits::kind == analysis::node_kind::group
+                               && analysis::is_capture<node>)
+            {
+                const auto after = enter_tagged_children(
+                    builder,
+                    continuation,
+                    static_cast<typename traits::children*>(nullptr));
+
+                return prepend(
+                    open_tag(traits::group_index),
+                    enter_tagged<typename traits::head>(
+                        builder, prepend(close_tag(traits::group_index), after)));
+            }
+            else
+            {
+                static_assert(traits::kind == analysis::node_kind::sequence
+                                  || traits::kind
+                                         == analysis::node_kind::group,
+                              "Anchors have no position automaton");
+
+                return enter_tagged<typename traits::head>(
+                    builder,
+                    enter_tagged_children(
+                        builder,
+                        continuation,
+                        static_cast<typename traits::children*>(nullptr)));
+            }
+        }
+
+        // At most one position of each list admits any byte
+        template<typename node>
+        constexpr auto is_one_pass() -> bool
+        {
+            tagged_builder builder;
+            const auto     first = enter_tagged<node>(builder, {{accept, {}}});
+
+            auto check = [&](const tagged_list& list) {
+                byte_set seen;
+
+                for (const auto& i: list)
+                {
+                    if (i.target < 0)
+                    {
+                        continue;
+                    }
+
+                    const auto& bytes = builder.bytes[i.target];
+
+                    if (!(seen & bytes).empty())
+                    {
+                        return false;
+                    }
+
+                    seen = seen | bytes;
+                }
+
+                return true;
+            };
+
+            bool result = check(builder.resolve(first));
+
+            for (const auto& follow: builder.follow)
+            {
+                result = result && check(builder.resolve(follow));
+            }
+
+            return result;
+        }
+
+        struct one_pass_sizes
+        {
+                unsigned positions = 0;
+                unsigned tags      = 0;
+        };
+
+        template<typename node>
+        constexpr auto count_one_pass() -> one_pass_sizes
+        {
+            tagged_builder builder;
+            const auto     first = enter_tagged<node>(builder, {{accept, {}}});
+
+            one_pass_sizes result {
+                static_cast<unsigned>(builder.bytes.size()), 0};
+
+            for (const auto& i: builder.resolve(first))
+            {
+                result.tags += i.tags.size();
+            }
+
+            for (const auto& follow: builder.follow)
+            {
+                for (const auto& i: builder.resolve(follow))
+                {
+                    result.tags += i.tags.size();
+                }
+            }
+
+            return result;
+        }
+
+        // Transition of a state on a byte class, or to accept
+        struct one_pass_edge
+        {
+                // Position + 1, 0 if there is none
+                std::uint16_t target = 0;
+
+                // Index in the list, lower ones are preferred
+                std::uint16_t rank = 0;
+
+                std::uint16_t tags_begin = 0;
+                std::uint16_t tags_end   = 0;
+        };
+
+        template<unsigned states, unsigned classes, unsigned tags>
+        struct one_pass_tables
+        {
+                // State 0 is the start, state p + 1 follows position p
+                std::array<std::array<one_pass_edge, classes>, states> next
+                    = {};
+
+                // Target 1 if the state can accept
+                std::array<one_pass_edge, states> accept = {};
+
+                std::array<tag, tags + 1> tag_data = {};
+        };
+
+        template<typename node,
+                 unsigned states,
+                 unsigned classes,
+                 unsigned tags>
+        constexpr auto make_one_pass_tables()
+            -> one_pass_tables<states, classes, tags>
+        {
+            tagged_builder builder;
+            const auto     first = enter_tagged<node>(builder, {{accept, {}}});
+            const auto&    map   = class_map<node>;
+
+            one_pass_tables<states, classes, tags> result;
+            unsigned                               tag_count = 0;
+
+            auto fill = [&](unsigned state, const tagged_list& list) {
+                for (unsigned rank = 0; rank < list.size(); ++rank)
+                {
+                    const auto& i = list[rank];
+
+                    one_pass_edge edge {
+                        .target     = static_cast<std::uint16_t>(i.target + 1),
+                        .rank       = static_cast<std::uint16_t>(rank),
+                        .tags_begin = static_cast<std::uint16_t>(tag_count),
+                        .tags_end   = static_cast<std::uint16_t>(
+                            tag_count + i.tags.size())};
+
+                    for (const auto t: i.tags)
+                    {
+                        result.tag_data[tag_count++] = t;
+                    }
+
+                    if (i.target == accept)
+                    {
+                        edge.target         = 1;
+                        result.accept[state] = edge;
+                        continue;
+                    }
+
+                    for (unsigned c = 0; c < 256; ++c)
+                    {
+                        if (builder.bytes[i.target].contains(c))
+                        {
+                            result.next[state][map.class_of[c]] = edge;
+                        }
+                    }
+                }
+            };
+
+            fill(0, builder.resolve(first));
+
+            for (unsigned p = 0; p < builder.follow.size(); ++p)
+            {
+                fill(p + 1, builder.resolve(builder.follow[p]));
+            }
+
+            return result;
+        }
+    } // namespace __private
+
+    /*
+     * Matcher for one-pass expressions: at every byte at most one
+     * position of the automaton can continue the match, so captures
+     * are recorded during a single forward scan, following the group
+     * boundaries crossed by each transition.
+     */
+    template<typename matcher>
+    struct one_pass
+    {
+            static constexpr auto groups = nodes::group_getter<matcher>::value;
+
+            static constexpr bool enabled = [] {
+                if constexpr (!analysis::has_anchor<matcher>
+                              && position_count<matcher> <= max_positions)
+                {
+                    return __private::is_one_pass<matcher>();
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+        private:
+            static constexpr auto sizes = [] {
+                if constexpr (enabled)
+                {
+                    return __private::count_one_pass<matcher>();
+                }
+                else
+                {
+                    return __private::one_pass_sizes {};
+                }
+            }();
+
+            static constexpr auto classes = [] {
+                if constexpr (enabled)
+                {
+                    return class_map<matcher>.count;
+                }
+                else
+                {
+                    return 1U;
+                }
+            }();
+
+            using tables = __private::
+                one_pass_tables<sizes.positions + 1, classes, sizes.tags>;
+
+            static constexpr auto data = [] {
+                if constexpr (enabled)
+                {
+                    return __private::make_one_pass_tables<matcher,
+                                                           sizes.positions
+                                                               + 1,
+                                                           classes,
+                                                           sizes.tags>();
+                }
+                else
+                {
+                    return tables {};
+                }
+            }();
+
+        public:
+            /**
+             * @brief Matches starting exactly at begin
+             *
+             * @return found if the match is stored in match_end and
+             * match_groups, ambiguous if the regex tree has to decide
+             */
+            static constexpr __attribute__((always_inline)) auto
+                match(const char*  begin,
+                      const char*  end,
+                      const char*& match_end,
+                      std::array<literal_string_view<>, groups>&
+                          match_groups) noexcept -> one_pass_result
+            {
+                constexpr auto& class_of = class_map<matcher>.class_of;
+
+                std::array<literal_string_view<>, groups> captures = {};
+                std::array<const char*, groups>           opened   = {};
+
+                auto apply = [&](const __private::one_pass_edge& edge,
+                                 const char*                     at) {
+                    for (auto t = edge.tags_begin; t < edge.tags_end; ++t)
+                    {
+                        const auto tag   = data.tag_data[t];
+                        const auto group = tag / 2;
+
+                        if ((tag & 1U) != 0)
+                        {
+                            opened[group] = at;
+                        }
+                        else
+                        {
+                            captures[group]
+                                = literal_string_view {opened[group], at};
+                        }
+                    }
+                };
+
+                // Whether an earlier end was passed over
+                bool     skipped_accept = false;
+                unsigned state          = 0;
+
+                for (const auto* current = begin;; ++current)
+                {
+                    const auto& accept = data.accept[state];
+
+                    __private::one_pass_edge next {};
+
+                    if (current < end)
+                    {
+                        next = data.next[state][class_of[static_cast<
+                            unsigned char>(*current)]];
+                    }
+
+                    if (accept.target != 0
+                        && (next.target == 0 || accept.rank < next.rank))
+                    {
+                        apply(accept, current);
+
+                        match_end    = current;
+                        match_groups = captures;
+
+                        return one_pass_result::found;
+                    }
+
+                    if (next.target == 0)
+                    {
+                        return skipped_accept ? one_pass_result::ambiguous
+                                              : one_pass_result::not_found;
+                    }
+
+                    skipped_accept = skipped_accept || accept.target != 0;
+
+                    apply(next, current);
+                    state = next.target;
+                }
+            }
+    };
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_ONE_PASS_HPP_*/
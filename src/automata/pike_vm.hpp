@@ -0,0 +1,447 @@
+#ifndef E_REGEX_AUTOMATA_PIKE_VM_HPP_
+#define E_REGEX_AUTOMATA_PIKE_VM_HPP_
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "analysis/anchors.hpp"
+#include "analysis/leftmost_first.hpp"
+#include "dfa.hpp"
+#include "nodes/common.hpp"
+#include "one_pass.hpp"
+#include "position_automaton.hpp"
+#include "search/searcher.hpp"
+#include "utilities/byte_set.hpp"
+#include "utilities/literal_string_view.hpp"
+
+namespace e_regex::automata
+{
+    namespace __private
+    {
+        // Item of a follow list, with the group boundaries crossed
+        struct pike_edge
+        {
+                // Position, or accept
+                std::int16_t target = accept;
+
+                std::uint16_t tags_begin = 0;
+                std::uint16_t tags_end   = 0;
+        };
+
+        struct pike_sizes
+        {
+                unsigned positions = 0;
+                unsigned edges     = 0;
+                unsigned tags      = 0;
+        };
+
+        template<typename node>
+        constexpr auto count_pike() -> pike_sizes
+        {
+            tagged_builder builder;
+            const auto     first = enter_tagged<node>(builder, {{accept, {}}});
+
+            pike_sizes result {
+                static_cast<unsigned>(builder.bytes.size()), 0, 0};
+
+            auto count = [&](const tagged_list& list) {
+                for (const auto& i: list)
+                {
+                    ++result.edges;
+                    result.tags += i.tags.size();
+                }
+            };
+
+            count(builder.resolve(first));
+
+            for (const auto& follow: builder.follow)
+            {
+                count(builder.resolve(follow));
+            }
+
+            return result;
+        }
+
+        template<unsigned positions, unsigned edges, unsigned tags>
+        struct pike_tables
+        {
+                std::array<byte_set, positions> bytes = {};
+
+                // The list of state s is edges [lists[s], lists[s + 1]):
+                // state 0 is the start, state p + 1 follows position p
+                std::array<std::uint16_t, positions + 2> lists = {};
+
+                std::array<pike_edge, edges + 1> edge_data = {};
+                std::array<tag, tags + 1>        tag_data  = {};
+        };
+
+        template<typename node,
+                 unsigned positions,
+                 unsigned edges,
+                 unsigned tags>
+        constexpr auto make_pike_tables()
+            -> pike_tables<positions, edges, tags>
+        {
+            tagged_builder builder;
+            const auto     first = enter_tagged<node>(builder, {{accept, {}}});
+
+            pike_tables<positions, edges, tags> result;
+            unsigned                            edge_count = 0;
+            unsigned                            tag_count  = 0;
+
+            auto fill = [&](unsigned state, const tagged_list& list) {
+                result.lists[state] = static_cast<std::uint16_t>(edge_count);
+
+                for (const auto& i: list)
+                {
+                    result.edge_data[edge_count++] = pike_edge {
+                        .target     = static_cast<std::int16_t>(i.target),
+                        .tags_begin = static_cast<std::uint16_t>(tag_count),
+                        .tags_end   = static_cast<std::uint16_t>(
+                            tag_count + i.tags.size())};
+
+                    for (const auto t: i.tags)
+                    {
+                        result.tag_data[tag_count++] = t;
+                    }
+                }
+            };
+
+            fill(0, builder.resolve(first));
+
+            for (unsigned p = 0; p < builder.follow.size(); ++p)
+            {
+                result.bytes[p] = builder.bytes[p];
+                fill(p + 1, builder.resolve(builder.follow[p]));
+            }
+
+            result.lists[builder.follow.size() + 1]
+                = static_cast<std::uint16_t>(edge_count);
+
+            return result;
+        }
+
+        // Groups recorded by a thread
+        template<unsigned groups>
+        struct pike_slots
+        {
+                const char*                               start = nullptr;
+                std::array<const char*, groups>           opened   = {};
+                std::array<literal_string_view<>, groups> captures = {};
+        };
+
+        // Threads waiting at each position, in priority order
+        template<unsigned positions, unsigned groups>
+        struct pike_threads
+        {
+                // Sparse set: dense[sparse[p]] == p if p is in it
+                std::array<std::uint16_t, positions> dense  = {};
+                std::array<std::uint16_t, positions> sparse = {};
+                unsigned                             size   = 0;
+
+                std::array<pike_slots<groups>, positions> slots = {};
+
+                constexpr auto contains(unsigned position) const noexcept
+                    -> bool
+                {
+                    return sparse[position] < size
+                           && dense[sparse[position]] == position;
+                }
+
+                constexpr auto insert(unsigned position) noexcept
+                    -> pike_slots<groups>&
+                {
+                    sparse[position] = static_cast<std::uint16_t>(size);
+                    dense[size]      = static_cast<std::uint16_t>(position);
+
+                    return slots[size++];
+                }
+        };
+    } // namespace __private
+
+    /*
+     * Thompson simulation of the tagged position automaton, a thread
+     * per position, each with its own groups: every byte is read once
+     * and advances at most one thread per position, in O(n·m) time.
+     * Threads are kept in priority order and cut below the first
+     * accepting one, so the match is the leftmost-first one; only
+     * expressions where it is also the backtracking match are
+     * supported.
+     */
+    template<typename matcher>
+    struct pike_vm
+    {
+            static constexpr auto groups = nodes::group_getter<matcher>::value;
+
+            // The tables can be built, full_match can run
+            static constexpr bool supported
+                = !analysis::has_anchor<matcher>
+                  && position_count<matcher> <= max_positions;
+
+            static constexpr bool enabled = [] {
+                if constexpr (supported)
+                {
+                    return analysis::captures_leftmost_first<matcher>;
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+        private:
+            static constexpr auto sizes = [] {
+                if constexpr (supported)
+                {
+                    return __private::count_pike<matcher>();
+                }
+                else
+                {
+                    return __private::pike_sizes {};
+                }
+            }();
+
+            static constexpr auto positions = sizes.positions + 1;
+
+            using tables = __private::
+                pike_tables<positions, sizes.edges, sizes.tags>;
+            using threads  = __private::pike_threads<positions, groups>;
+            using slots    = __private::pike_slots<groups>;
+            using searcher = search::searcher<matcher>;
+
+            static constexpr auto data = [] {
+                if constexpr (supported)
+                {
+                    return __private::make_pike_tables<matcher,
+                                                       positions,
+                                                       sizes.edges,
+                                                       sizes.tags>();
+                }
+                else
+                {
+                    return tables {};
+                }
+            }();
+
+            /*
+             * Follows the list of state at position at, for a thread
+             * with thread_slots: returns true if it reached accept,
+             * whose groups are stored in found. Unless accepting, the
+             * accept item is skipped.
+             */
+            static constexpr __attribute__((always_inline)) auto
+                follow(unsigned    state,
+                       const char* at,
+                       const slots& thread_slots,
+                       threads&     next,
+                       slots&       found,
+                       bool         accepting = true) noexcept -> bool
+            {
+                for (auto e = data.lists[state]; e < data.lists[state + 1];
+                     ++e)
+                {
+                    const auto& edge = data.edge_data[e];
+
+                    if (edge.target >= 0
+                        && next.contains(static_cast<unsigned>(edge.target)))
+                    {
+                        // An earlier thread is already there
+                        continue;
+                    }
+
+                    if (edge.target < 0 && !accepting)
+                    {
+                        continue;
+                    }
+
+                    auto& target = edge.target >= 0
+                                       ? next.insert(static_cast<unsigned>(
+                                           edge.target))
+                                       : found;
+                    target = thread_slots;
+
+                    for (auto t = edge.tags_begin; t < edge.tags_end; ++t)
+                    {
+                        const auto tag   = data.tag_data[t];
+                        const auto group = tag / 2;
+
+                        if ((tag & 1U) != 0)
+                        {
+                            target.opened[group] = at;
+                        }
+                        else
+                        {
+                            target.captures[group]
+                                = literal_string_view {target.opened[group],
+                                                       at};
+                        }
+                    }
+
+                    if (edge.target < 0)
+                    {
+                        // The following items are less preferred
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+        public:
+            /**
+             * @brief Finds the leftmost-first match in [begin, end)
+             *
+             * @param anchored if true, only matches starting at begin
+             * are found
+             * @return false if there is none, otherwise the match is
+             * stored in match_begin, match_end and match_groups
+             */
+            static constexpr __attribute__((always_inline)) auto
+                find(const char*               begin,
+                     const char*               end,
+                     bool                      anchored,
+                     typename searcher::state& search_state,
+                     const char*&              match_begin,
+                     const char*&              match_end,
+                     std::array<literal_string_view<>, groups>&
+                         match_groups) noexcept -> bool
+            {
+                std::array<threads, 2> lists;
+
+                auto* current = &lists[0];
+                auto* next    = &lists[1];
+
+                slots found;
+                bool  matched = false;
+
+                for (const auto* position = begin;; ++position)
+                {
+                    if (!matched && (!anchored || position == begin))
+                    {
+                        if (current->size == 0 && !anchored)
+                        {
+                            // No thread is alive, skip to the next
+                            // candidate
+                            position
+                                = searcher::find(position, end, search_state);
+
+                            if (position >= end)
+                            {
+                                break;
+                            }
+                        }
+
+                        // A new attempt, after all the older ones
+                        slots fresh;
+                        fresh.start = position;
+
+                        // Expressions are not nullable, the start list
+                        // never accepts
+                        follow(0, position, fresh, *current, found);
+                    }
+
+                    if (current->size == 0 || position >= end)
+                    {
+                        break;
+                    }
+
+                    const auto c = static_cast<unsigned char>(*position);
+                    next->size   = 0;
+
+                    for (unsigned t = 0; t < current->size; ++t)
+                    {
+                        const auto p = current->dense[t];
+
+                        if (data.bytes[p].contains(c)
+                            && follow(p + 1,
+                                      position + 1,
+                                      current->slots[t],
+                                      *next,
+                                      found))
+                        {
+                            // Later threads started later or are less
+                            // preferred
+                            matched   = true;
+                            match_end = position + 1;
+                            break;
+                        }
+                    }
+
+                    std::swap(current, next);
+                }
+
+                if (!matched)
+                {
+                    return false;
+                }
+
+                match_begin  = found.start;
+                match_groups = found.captures;
+
+                return true;
+            }
+
+            /**
+             * @brief True if [begin, end) is a match, the groups of the
+             * most preferred one are stored in match_groups
+             *
+             * Only matches ending at end are accepted, so choices the
+             * backtracking matcher commits to are all tried.
+             */
+            static constexpr __attribute__((always_inline)) auto
+                full_match(const char* begin,
+                           const char* end,
+                           std::array<literal_string_view<>, groups>&
+                               match_groups) noexcept -> bool
+            {
+                std::array<threads, 2> lists;
+
+                auto* current = &lists[0];
+                auto* next    = &lists[1];
+
+                slots found;
+                slots fresh;
+                fresh.start = begin;
+
+                bool matched
+                    = follow(0, begin, fresh, *current, found, begin == end);
+
+                for (const auto* position = begin;
+                     !matched && current->size != 0 && position < end;
+                     ++position)
+                {
+                    const auto c = static_cast<unsigned char>(*position);
+                    next->size   = 0;
+
+                    for (unsigned t = 0; t < current->size; ++t)
+                    {
+                        const auto p = current->dense[t];
+
+                        if (data.bytes[p].contains(c)
+                            && follow(p + 1,
+                                      position + 1,
+                                      current->slots[t],
+                                      *next,
+                                      found,
+                                      position + 1 == end))
+                        {
+                            matched = true;
+                            break;
+                        }
+                    }
+
+                    std::swap(current, next);
+                }
+
+                if (matched)
+                {
+                    match_groups = found.captures;
+                }
+
+                return matched;
+            }
+    };
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_PIKE_VM_HPP_*/
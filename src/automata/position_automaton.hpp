@@ -0,0 +1,337 @@
+#ifndef E_REGEX_AUTOMATA_POSITION_AUTOMATON_HPP_
+#define E_REGEX_AUTOMATA_POSITION_AUTOMATON_HPP_
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "analysis/node_traits.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::automata
+{
+    // Largest position automata built at compile time
+    inline constexpr auto max_positions = 128U;
+
+    /*
+     * Items of an ordered thread list: a position waiting for its
+     * byte, or one of the markers below. Lists are kept in priority
+     * order, as a backtracking matcher would try them.
+     */
+    using item = int;
+
+    // The match is complete
+    inline constexpr item accept = -1;
+
+    // A new match can start at the next byte
+    inline constexpr item restart = -2;
+
+    struct position
+    {
+            byte_set          bytes;
+            std::vector<item> follow;
+    };
+
+    // Glushkov automaton with ordered follow lists
+    struct position_automaton
+    {
+            std::vector<position> positions;
+            std::vector<item>     first;
+    };
+
+    namespace __private
+    {
+        constexpr void append_unique(std::vector<item>&       list,
+                                     const std::vector<item>& items)
+        {
+            for (const auto i: items)
+            {
+                if (std::find(list.begin(), list.end(), i) == list.end())
+                {
+                    list.push_back(i);
+                }
+            }
+        }
+
+        struct builder
+        {
+                std::vector<position> positions;
+
+                // Lists reached by re-entering each unbounded loop
+                std::vector<std::vector<item>> loops;
+
+                static constexpr auto loop_item(unsigned loop) -> item
+                {
+                    return -3 - static_cast<item>(loop);
+                }
+
+                static constexpr auto loop_of(item i) -> unsigned
+                {
+                    return static_cast<unsigned>(-3 - i);
+                }
+
+                constexpr auto add(const byte_set&          bytes,
+                                   const std::vector<item>& follow) -> item
+                {
+                    positions.push_back(position {bytes, follow});
+
+                    return static_cast<item>(positions.size() - 1);
+                }
+
+                // Replaces loop placeholders with the lists they stand
+                // for
+                constexpr void resolve(const std::vector<item>& list,
+                                       std::vector<item>&       result,
+                                       std::vector<bool>& expanding) const
+                {
+                    for (const auto i: list)
+                    {
+                        if (i >= accept)
+                        {
+                            append_unique(result, {i});
+                        }
+                        else if (!expanding[loop_of(i)])
+                        {
+                            expanding[loop_of(i)] = true;
+                            resolve(loops[loop_of(i)], result, expanding);
+                            expanding[loop_of(i)] = false;
+                        }
+                    }
+                }
+
+                constexpr auto resolve(const std::vector<item>& list) const
+                    -> std::vector<item>
+                {
+                    std::vector<item> result;
+                    std::vector<bool> expanding(loops.size(), false);
+                    resolve(list, result, expanding);
+
+                    return result;
+                }
+        };
+
+        template<typename node>
+        constexpr auto enter(builder&                 builder,
+                             const std::vector<item>& continuation)
+            -> std::vector<item>;
+
+        template<typename children>
+        struct enter_alternation;
+
+        template<typename... children>
+        struct enter_alternation<std::tuple<children...>>
+        {
+                // The list reached entering any branch, in order
+                static constexpr auto
+                    apply(builder&                 builder,
+                          const std::vector<item>& continuation)
+                        -> std::vector<item>
+                {
+                    if constexpr (sizeof...(children) == 0)
+                    {
+                        return continuation;
+                    }
+                    else
+                    {
+                        std::vector<item> result;
+                        (append_unique(result,
+                                       enter<children>(builder, continuation)),
+                         ...);
+
+                        return result;
+                    }
+                }
+        };
+
+        template<typename traits>
+        constexpr auto enter_repetition(builder&                 builder,
+                                        const std::vector<item>& continuation)
+            -> std::vector<item>
+        {
+            using head = typename traits::head;
+
+            const auto after = enter_alternation<
+                typename traits::children>::apply(builder, continuation);
+            constexpr bool lazy = traits::policy_ == policy::LAZY;
+
+            // Ordered choice between one more iteration and leaving
+            auto choice = [&](const std::vector<item>& iteration) {
+                std::vector<item> result;
+                append_unique(result, lazy ? after : iteration);
+                append_unique(result, lazy ? iteration : after);
+
+                return result;
+            };
+
+            auto result = after;
+
+            if constexpr (traits::maximum == analysis::unbounded)
+            {
+                const auto loop = static_cast<unsigned>(builder.loops.size());
+                builder.loops.emplace_back();
+
+                const auto iteration
+                    = enter<head>(builder, {builder::loop_item(loop)});
+                builder.loops[loop] = choice(iteration);
+                result              = {builder::loop_item(loop)};
+            }
+            else
+            {
+                for (unsigned i = traits::minimum; i < traits::maximum; ++i)
+                {
+                    result = choice(enter<head>(builder, result));
+                }
+            }
+
+            for (unsigned i = 0; i < traits::minimum; ++i)
+            {
+                result = enter<head>(builder, result);
+            }
+
+            return result;
+        }
+
+        template<typename node>
+        constexpr auto enter(builder&                 builder,
+                             const std::vector<item>& continuation)
+            -> std::vector<item>
+        {
+            using traits = analysis::node_traits<node>;
+
+            if constexpr (traits::kind == analysis::node_kind::bytes)
+            {
+                return {builder.add(traits::bytes, continuation)};
+            }
+            else if constexpr (traits::kind == analysis::node_kind::literal)
+            {
+                auto result = continuation;
+
+                for (auto i = traits::literal.size(); i > 0; --i)
+                {
+                    byte_set bytes;
+                    bytes.insert(
+                        static_cast<unsigned char>(traits::literal[i - 1]));
+
+                    result = {builder.add(bytes, result)};
+                }
+
+                return result;
+            }
+            else if constexpr (traits::kind
+                               == analysis::node_kind::alternation)
+            {
+                return enter_alternation<typename traits::children>::apply(
+                    builder, continuation);
+            }
+            else if constexpr (traits::kind
+                               == analysis::node_kind::repetition)
+            {
+                return enter_repetition<traits>(builder, continuation);
+            }
+            else
+            {
+                static_assert(traits::kind == analysis::node_kind::sequence
+                                  || traits::kind
+                                         == analysis::node_kind::group,
+                              "Anchors have no position automaton");
+
+                return enter<typename traits::head>(
+                    builder,
+                    enter_alternation<typename traits::children>::apply(
+                        builder, continuation));
+            }
+        }
+
+        // Positions created by enter, without building them
+        template<typename node>
+        constexpr auto count_positions() noexcept -> unsigned;
+
+        template<typename... children>
+        constexpr auto count_children(std::tuple<children...>*) noexcept
+            -> unsigned
+        {
+            return (0U + ... + count_positions<children>());
+        }
+
+        template<typename node>
+        constexpr auto count_positions() noexcept -> unsigned
+        {
+            using traits = analysis::node_traits<node>;
+
+            constexpr auto children = count_children(
+                static_cast<typename traits::children*>(nullptr));
+
+            if constexpr (traits::kind == analysis::node_kind::bytes)
+            {
+                return 1;
+            }
+            else if constexpr (traits::kind == analysis::node_kind::literal)
+            {
+                return traits::literal.size();
+            }
+            else if constexpr (traits::kind
+                               == analysis::node_kind::alternation)
+            {
+                return children;
+            }
+            else if constexpr (traits::kind
+                               == analysis::node_kind::repetition)
+            {
+                constexpr auto copies = traits::maximum == analysis::unbounded
+                                            ? traits::minimum + 1ULL
+                                            : 0ULL + traits::maximum;
+                constexpr auto total
+                    = copies * count_positions<typename traits::head>()
+                      + children;
+
+                return total > analysis::unbounded ? analysis::unbounded
+                                                   : total;
+            }
+            else if constexpr (traits::kind == analysis::node_kind::sequence
+                               || traits::kind
+                                      == analysis::node_kind::group)
+            {
+                return count_positions<typename traits::head>() + children;
+            }
+            else
+            {
+                return 0;
+            }
+        }
+    } // namespace __private
+
+    /**
+     * @brief Number of positions in the automaton of node
+     */
+    template<typename node>
+    inline constexpr auto position_count = __private::count_positions<node>();
+
+    /**
+     * @brief Builds the position automaton of node
+     *
+     * Follow lists are ordered like the choices of a backtracking
+     * matcher, with accept marking where a match can end. Counted
+     * repetitions are unrolled.
+     */
+    template<typename node>
+    constexpr auto make_position_automaton() -> position_automaton
+    {
+        __private::builder builder;
+
+        const auto first = __private::enter<node>(builder, {accept});
+
+        position_automaton result;
+        result.first = builder.resolve(first);
+
+        for (const auto& position: builder.positions)
+        {
+            result.positions.push_back(
+                automata::position {position.bytes,
+                                    builder.resolve(position.follow)});
+        }
+
+        return result;
+    }
+} // namespace e_regex::automata
+
+#endif /* E_REGEX_AUTOMATA_POSITION_AUTOMATON_HPP_*/
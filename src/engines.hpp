@@ -0,0 +1,79 @@
+#ifndef E_REGEX_ENGINES_HPP_
+#define E_REGEX_ENGINES_HPP_
+
+#include <cstddef>
+
+namespace e_regex::engines
+{
+    // Compile-time DFA when the regex supports it, the regex tree
+    // otherwise
+    struct automatic
+    {};
+
+    // Always the backtracking regex tree
+    struct backtracking
+    {};
+
+    /*
+     * DFA built while matching, with at most cache_states states
+     * cached per thread. Used for regexes that would need a too large
+     * compile-time DFA; at compile time the regex tree is used.
+     */
+    template<unsigned cache_states = 64>
+    struct lazy_dfa
+    {
+            static constexpr auto states = cache_states;
+    };
+
+    /*
+     * Bit-parallel position automaton, that rejects inputs without
+     * a match in linear time; the regex tree only runs before the
+     * end of the first match found.
+     */
+    struct bit_parallel
+    {};
+
+    /*
+     * Thread per position simulation of the automaton, carrying the
+     * groups of each thread: linear in the query size, captures
+     * included. Used when its leftmost-first match is the one of the
+     * regex tree, which is used otherwise.
+     */
+    struct pike_vm
+    {};
+
+    /*
+     * Regex tree remembering, in a scratch buffer provided by the
+     * caller, the positions where each greedy or lazy repetition
+     * already failed: none is attempted twice at the same position,
+     * so nested quantifiers cannot blow up. See regex::scratch_size.
+     */
+    struct memoized
+    {};
+
+    /*
+     * Regex tree giving up after max_steps node attempts and
+     * backtracking iterations per search: the search then fails with
+     * match_result::is_exhausted() set, so that the caller can hand
+     * the query to a safer engine.
+     */
+    template<std::size_t max_steps>
+    struct budgeted
+    {
+            static constexpr auto steps = max_steps;
+    };
+
+    template<typename engine>
+    inline constexpr bool is_lazy_dfa = false;
+
+    template<unsigned cache_states>
+    inline constexpr bool is_lazy_dfa<lazy_dfa<cache_states>> = true;
+
+    template<typename engine>
+    inline constexpr bool is_budgeted = false;
+
+    template<std::size_t max_steps>
+    inline constexpr bool is_budgeted<budgeted<max_steps>> = true;
+} // namespace e_regex::engines
+
+#endif /* E_REGEX_ENGINES_HPP_*/
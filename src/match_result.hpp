@@ -1,15 +1,165 @@
 #ifndef E_REGEX_MATCH_RESULT_HPP_
 #define E_REGEX_MATCH_RESULT_HPP_
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
 
+#include "analysis/leading_run.hpp"
+#include "analysis/memo_sites.hpp"
+#include "analysis/prefix_shifts.hpp"
+#include "automata/aho_corasick.hpp"
+#include "automata/bit_nfa.hpp"
+#include "automata/dfa.hpp"
+#include "automata/lazy_dfa.hpp"
+#include "automata/one_pass.hpp"
+#include "automata/pike_vm.hpp"
+#include "engines.hpp"
 #include "nodes/common.hpp"
+#include "nodes/strip_groups.hpp"
+#include "search/searcher.hpp"
 #include "utilities/literal_string_view.hpp"
 
 namespace e_regex
 {
-    template<unsigned groups, typename Char_Type>
+    // Failures are not remembered
+    struct no_failures
+    {
+            template<typename node, typename... injected_children>
+            constexpr auto failed(const char* /*position*/) const noexcept
+                -> bool
+            {
+                return false;
+            }
+
+            template<typename node, typename... injected_children>
+            constexpr void record(const char* /*position*/) noexcept
+            {}
+    };
+
+    /*
+     * A bit per memo site of matcher and per position of the query,
+     * set when the site failed there. Positions past the capacity of
+     * the scratch buffer are not remembered.
+     */
+    template<typename matcher>
+    class failure_memo
+    {
+        public:
+            static constexpr std::size_t sites
+                = std::tuple_size_v<analysis::memo_sites_t<matcher>>;
+
+            /**
+             * @brief Words of scratch needed to remember every
+             * position of a query of size bytes
+             */
+            static constexpr auto words(std::size_t size) noexcept
+                -> std::size_t
+            {
+                return (sites * (size + 1) + 63) / 64;
+            }
+
+            constexpr failure_memo() noexcept = default;
+
+            constexpr failure_memo(literal_string_view<>     query,
+                                   std::span<std::uint64_t> scratch) noexcept
+                : bits {scratch.data()}
+                , origin {query.begin()}
+                , positions {sites == 0 ? 0
+                                        : std::min<std::size_t>(
+                                            query.size() + 1,
+                                            scratch.size() * 64 / sites)}
+            {
+                std::fill_n(bits, (sites * positions + 63) / 64, 0);
+            }
+
+            template<typename node, typename... injected_children>
+            constexpr auto failed(const char* position) const noexcept
+                -> bool
+            {
+                const auto bit = index<node, injected_children...>(position);
+
+                return bit < sites * positions
+                       && (bits[bit / 64] & (std::uint64_t {1} << (bit % 64)))
+                              != 0;
+            }
+
+            template<typename node, typename... injected_children>
+            constexpr void record(const char* position) noexcept
+            {
+                const auto bit = index<node, injected_children...>(position);
+
+                if (bit < sites * positions)
+                {
+                    bits[bit / 64] |= std::uint64_t {1} << (bit % 64);
+                }
+            }
+
+        private:
+            std::uint64_t* bits      = nullptr;
+            const char*    origin    = nullptr;
+            std::size_t    positions = 0;
+
+            template<typename node, typename... injected_children>
+            constexpr auto index(const char* position) const noexcept
+                -> std::size_t
+            {
+                constexpr auto site = analysis::
+                    memo_site_index<matcher, node, injected_children...>;
+
+                static_assert(site < sites,
+                              "Repetition missing from the memo sites.");
+
+                return static_cast<std::size_t>(position - origin) * sites
+                       + site;
+            }
+    };
+
+    // Steps are not counted
+    struct unlimited_steps
+    {
+            constexpr auto take() noexcept -> bool
+            {
+                return true;
+            }
+
+            constexpr auto exhausted() const noexcept -> bool
+            {
+                return false;
+            }
+    };
+
+    // Once remaining steps are taken, every other one fails
+    struct step_budget
+    {
+            std::size_t remaining = 0;
+            bool        overrun   = false;
+
+            constexpr auto take() noexcept -> bool
+            {
+                if (remaining == 0)
+                {
+                    overrun = true;
+                    return false;
+                }
+
+                --remaining;
+                return true;
+            }
+
+            constexpr auto exhausted() const noexcept -> bool
+            {
+                return overrun;
+            }
+    };
+
+    template<unsigned groups,
+             typename Char_Type,
+             typename failure_table = no_failures,
+             typename step_counter  = unlimited_steps>
     struct match_result_data
     {
             literal_string_view<Char_Type> query;
@@ -19,6 +169,12 @@ namespace e_regex
                 = {};
             bool accepted = true;
 
+            // Where repetitions already failed
+            failure_table failures = {};
+
+            // Steps left to the regex tree
+            step_counter steps = {};
+
             constexpr auto __attribute__((always_inline))
             operator=(bool accepted) noexcept -> match_result_data&
             {
@@ -34,7 +190,9 @@ namespace e_regex
             }
     };
 
-    template<typename matcher, typename Char_Type = char>
+    template<typename matcher,
+             typename Char_Type = char,
+             typename engine    = engines::automatic>
     class match_result
     {
         public:
@@ -44,34 +202,323 @@ namespace e_regex
             static constexpr auto groups_
                 = nodes::group_getter<matcher>::value;
 
-            match_result_data<groups_, Char_Type> data;
+            using dfa          = automata::dfa<matcher>;
+            using aho_corasick = automata::aho_corasick<matcher>;
+
+            // Same matches, without groups
+            using capture_free        = nodes::strip_groups_t<matcher>;
+            using bounds_dfa          = automata::dfa<capture_free>;
+            using bounds_aho_corasick = automata::aho_corasick<capture_free>;
+
+            static constexpr bool use_dfa = [] {
+                if constexpr (std::is_same_v<engine, engines::automatic>)
+                {
+                    return dfa::enabled;
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+            // Literal alternations too large for the DFA
+            static constexpr bool use_aho_corasick = [] {
+                if constexpr (std::is_same_v<engine, engines::automatic>)
+                {
+                    return groups_ == 0 && !dfa::enabled
+                           && aho_corasick::enabled;
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+            /*
+             * Regexes kept off the automata only by their groups: an
+             * automaton finds the match bounds, then the groups are
+             * recorded within them
+             */
+            static constexpr bool use_bounds = [] {
+                if constexpr (std::is_same_v<engine, engines::automatic>)
+                {
+                    return groups_ > 0
+                           && (bounds_dfa::enabled
+                               || bounds_aho_corasick::enabled);
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+            using searcher = search::searcher<
+                std::conditional_t<use_bounds, capture_free, matcher>>;
+
+            // Captures recorded in a single forward scan
+            static constexpr bool use_one_pass = [] {
+                if constexpr (std::is_same_v<engine, engines::automatic>)
+                {
+                    return !use_dfa && !use_aho_corasick
+                           && automata::one_pass<matcher>::enabled;
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+            static constexpr bool use_lazy_dfa = [] {
+                if constexpr (engines::is_lazy_dfa<engine>)
+                {
+                    return automata::lazy_dfa<matcher,
+                                              engine::states>::enabled;
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+            static constexpr bool use_bit_nfa = [] {
+                if constexpr (std::is_same_v<engine, engines::bit_parallel>)
+                {
+                    return automata::bit_nfa<matcher>::enabled;
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+            static constexpr bool use_pike_vm = [] {
+                if constexpr (std::is_same_v<engine, engines::pike_vm>)
+                {
+                    return automata::pike_vm<matcher>::enabled;
+                }
+                else
+                {
+                    return false;
+                }
+            }();
+
+            static constexpr bool use_memo
+                = std::is_same_v<engine, engines::memoized>;
+
+            using failure_table
+                = std::conditional_t<use_memo, failure_memo<matcher>, no_failures>;
+
+            using step_counter = std::conditional_t<engines::is_budgeted<engine>,
+                                                    step_budget,
+                                                    unlimited_steps>;
+
+            match_result_data<groups_, Char_Type, failure_table, step_counter>
+                data;
+            typename searcher::state search_state;
 
         public:
+            /**
+             * @brief Matches query
+             *
+             * @param search if false, only the beginning of query is
+             * attempted
+             */
             constexpr __attribute__((always_inline))
-            match_result(literal_string_view<> query) noexcept
+            match_result(literal_string_view<> query,
+                         bool                  search = true) noexcept
             {
-                data.query                 = query;
-                data.actual_iterator_start = query.begin();
-                data.actual_iterator_end = data.actual_iterator_start;
+                start(query, search);
+            }
+
+            /**
+             * @brief Matches query, remembering failed repetitions in
+             * scratch
+             *
+             * @param scratch at least failure_memo::words(query.size())
+             * words, otherwise later positions are not remembered
+             */
+            constexpr __attribute__((always_inline))
+            match_result(literal_string_view<>    query,
+                         std::span<std::uint64_t> scratch,
+                         bool                     search = true) noexcept
+                requires use_memo
+            {
+                data.failures = {query, scratch};
+                start(query, search);
+            }
+
+            /**
+             * @brief Finds the last match of query, trying positions
+             * from the end
+             */
+            static constexpr __attribute__((always_inline)) auto
+                find_last(literal_string_view<> query) noexcept
+                -> match_result
+            {
+                using first_byte = search::first_byte<matcher>;
+
+                match_result result;
+                result.data.query = query;
+                result.refill();
+
+                if constexpr (matcher::meta.minimum_match_size == 0)
+                {
+                    // The empty match at the end
+                    result.attempt_at(query.end());
+
+                    if (result.data.accepted)
+                    {
+                        return result;
+                    }
+                }
+
+                for (auto start = query.end(); start != query.begin();)
+                {
+                    const auto* candidate
+                        = first_byte::find_last(query.begin(), start);
+
+                    if (candidate == start)
+                    {
+                        break;
+                    }
+
+                    result.attempt_at(candidate);
+
+                    if (result.is_exhausted())
+                    {
+                        return result;
+                    }
+
+                    if (result.data.accepted)
+                    {
+                        // The candidate can be inside the last match,
+                        // as the 5 of 345 for \d+
+                        result.move_to_first_start(query.begin());
+
+                        return result;
+                    }
+
+                    start = candidate;
+                }
+
+                result.fail();
+
+                return result;
+            }
+
+            /**
+             * @brief Matches query only if a match spans all of it
+             */
+            static constexpr __attribute__((always_inline)) auto
+                full_match(literal_string_view<> query) noexcept
+                -> match_result
+            {
+                using class_scan = search::class_scan<matcher>;
+
+                if constexpr (class_scan::enabled)
+                {
+                    const auto valid
+                        = class_scan::matches(query.begin(), query.end());
+
+                    // The tree is only run to record groups
+                    if (!valid || groups_ == 0)
+                    {
+                        match_result result;
+                        result.data.query = query;
+                        result.refill();
+
+                        if (valid)
+                        {
+                            result.data.actual_iterator_start = query.begin();
+                            result.data.actual_iterator_end   = query.end();
+                            result.data.accepted              = true;
+                        }
+                        else
+                        {
+                            result.fail();
+                        }
+
+                        return result;
+                    }
+                }
+
+                match_result result {query, false};
+
+                if (result.is_accepted()
+                    && result.to_view().end()
+                           == static_cast<std::string_view>(query).end())
+                {
+                    return result;
+                }
 
-                data = matcher::match(data);
-                if (!data)
+                // The match at the beginning stopped early, but it may
+                // have committed to a choice another one spans query
+                // with, as the first branch of a|ab
+                using pike_vm = automata::pike_vm<matcher>;
+
+                if constexpr (pike_vm::supported)
                 {
-                    next();
+                    if (!result.is_exhausted())
+                    {
+                        result.data.actual_iterator_start = query.begin();
+                        result.data.actual_iterator_end   = query.end();
+                        result.data.match_groups          = {};
+                        result.data.accepted              = pike_vm::full_match(
+                            query.begin(), query.end(), result.data.match_groups);
+
+                        return result;
+                    }
+                }
+
+                result = false;
+
+                return result;
+            }
+
+            /**
+             * @brief True if query contains a match, stopping as soon
+             * as one is known to exist
+             */
+            static constexpr __attribute__((always_inline)) auto
+                contains(literal_string_view<> query) noexcept -> bool
+            {
+                if constexpr (use_dfa)
+                {
+                    typename searcher::state search_state {};
+
+                    return dfa::contains(
+                        query.begin(), query.end(), search_state);
+                }
+                else
+                {
+                    return match_result {query}.is_accepted();
                 }
             }
 
             constexpr __attribute__((always_inline)) auto
                 operator=(bool accepted) noexcept -> match_result&
             {
-                this->accepted = accepted;
+                data.accepted = accepted;
 
                 return *this;
             }
 
             constexpr __attribute__((always_inline)) auto begin() const noexcept
             {
-                return match_result {data.query};
+                if constexpr (use_memo)
+                {
+                    // Failures recorded on the same query still hold
+                    auto result              = *this;
+                    result.search_state      = {};
+                    result.data.match_groups = {};
+                    result.start(data.query, true);
+
+                    return result;
+                }
+                else
+                {
+                    return match_result {data.query};
+                }
             }
 
             constexpr __attribute__((always_inline)) auto
@@ -114,6 +561,16 @@ namespace e_regex
                 return operator bool();
             }
 
+            /**
+             * @brief True if the last search ran out of steps, and
+             * was abandoned
+             */
+            constexpr __attribute__((always_inline)) auto
+                is_exhausted() const noexcept
+            {
+                return data.steps.exhausted();
+            }
+
             template<unsigned index>
             constexpr __attribute__((always_inline)) auto get() const noexcept
             {
@@ -175,24 +632,380 @@ namespace e_regex
              * @return false if there are no other matches
              */
             constexpr __attribute__((always_inline)) auto next() noexcept
+            {
+                refill();
+
+                if (data.actual_iterator_start == data.actual_iterator_end)
+                {
+                    // The same empty match would be found again
+                    if (data.actual_iterator_end == data.query.end())
+                    {
+                        return fail();
+                    }
+
+                    return find(data.actual_iterator_end + 1);
+                }
+
+                return find(data.actual_iterator_end);
+            }
+
+        private:
+            constexpr match_result() noexcept = default;
+
+            constexpr __attribute__((always_inline)) void
+                start(literal_string_view<> query, bool search) noexcept
+            {
+                data.query                 = query;
+                data.actual_iterator_start = query.begin();
+                data.actual_iterator_end = data.actual_iterator_start;
+                refill();
+
+                if constexpr (use_dfa || use_aho_corasick || use_bounds
+                              || use_lazy_dfa || use_bit_nfa || use_pike_vm)
+                {
+                    if (search)
+                    {
+                        find(query.begin());
+                        return;
+                    }
+                }
+
+                attempt();
+                if (!data && search && query.begin() != query.end()
+                    && !data.steps.exhausted())
+                {
+                    find(resume(query.begin()));
+                }
+            }
+
+            // Finds the first match starting from begin
+            constexpr __attribute__((always_inline)) auto
+                find(const char* begin) noexcept -> bool
             {
                 data.match_groups = {};
-                data.actual_iterator_start = data.actual_iterator_end;
 
-                while (data.actual_iterator_start < data.query.end())
+                if constexpr (use_dfa)
+                {
+                    if (dfa::find(begin,
+                                  data.query.end(),
+                                  search_state,
+                                  data.actual_iterator_start,
+                                  data.actual_iterator_end))
+                    {
+                        data.accepted = true;
+                        return true;
+                    }
+                }
+                else if constexpr (use_aho_corasick)
+                {
+                    unsigned branch = 0;
+
+                    if (aho_corasick::find(begin,
+                                           data.query.end(),
+                                           search_state,
+                                           data.actual_iterator_start,
+                                           data.actual_iterator_end,
+                                           branch))
+                    {
+                        data.accepted = true;
+                        return true;
+                    }
+                }
+                else if constexpr (use_bounds)
                 {
-                    matcher::match(data);
+                    const char* end = nullptr;
 
-                    if (data.accepted)
+                    if (find_bounds(begin, end))
+                    {
+                        // The groups are recorded running on the match
+                        // alone, which ends where it would anyway
+                        const auto query         = data.query;
+                        data.query               = {query.begin(), end};
+                        data.actual_iterator_end = data.actual_iterator_start;
+                        attempt();
+                        data.query = query;
+
+                        if (data.accepted)
+                        {
+                            return true;
+                        }
+                    }
+                }
+                else if constexpr (use_pike_vm)
+                {
+                    if (automata::pike_vm<matcher>::find(
+                            begin,
+                            data.query.end(),
+                            false,
+                            search_state,
+                            data.actual_iterator_start,
+                            data.actual_iterator_end,
+                            data.match_groups))
                     {
+                        data.accepted = true;
                         return true;
                     }
+                }
+                else
+                {
+                    if constexpr (use_lazy_dfa)
+                    {
+                        if (!std::is_constant_evaluated())
+                        {
+                            using lazy_dfa
+                                = automata::lazy_dfa<matcher, engine::states>;
+
+                            const auto result
+                                = lazy_dfa::find(begin,
+                                                 data.query.end(),
+                                                 search_state,
+                                                 data.actual_iterator_start,
+                                                 data.actual_iterator_end);
+
+                            if (result == automata::lazy_result::found)
+                            {
+                                data.accepted = true;
+                                return true;
+                            }
+
+                            if (result == automata::lazy_result::not_found)
+                            {
+                                return fail();
+                            }
+
+                            // The cache is thrashing, the search state
+                            // is restarted
+                            search_state = {};
+                        }
+                    }
+
+                    // End of the earliest match found by the
+                    // bit-parallel automaton: past it, a new scan must
+                    // tell whether a match is still possible
+                    const char* limit = nullptr;
+
+                    for (auto start = begin;; start = resume(start))
+                    {
+                        // Jump to the next position that can start a
+                        // match
+                        start = searcher::find(
+                            start, data.query.end(), search_state);
+
+                        if (start >= data.query.end())
+                        {
+                            break;
+                        }
+
+                        if constexpr (use_bit_nfa)
+                        {
+                            if (limit == nullptr || start > limit)
+                            {
+                                limit = automata::bit_nfa<matcher>::find_end(
+                                    start, data.query.end());
+
+                                if (limit == nullptr)
+                                {
+                                    break;
+                                }
+                            }
+                        }
+
+                        data.actual_iterator_start = start;
+                        data.actual_iterator_end   = start;
+                        attempt();
+
+                        if (data.steps.exhausted())
+                        {
+                            break;
+                        }
+
+                        if (data.accepted)
+                        {
+                            return true;
+                        }
+                    }
+                }
+
+                return fail();
+            }
 
-                    data.actual_iterator_start
-                        = ++data.actual_iterator_end;
+            // Bounds of the first match starting from begin
+            constexpr __attribute__((always_inline)) auto
+                find_bounds(const char* begin, const char*& end) noexcept
+                -> bool
+            {
+                if constexpr (bounds_dfa::enabled)
+                {
+                    return bounds_dfa::find(begin,
+                                            data.query.end(),
+                                            search_state,
+                                            data.actual_iterator_start,
+                                            end);
+                }
+                else
+                {
+                    unsigned branch = 0;
+
+                    return bounds_aho_corasick::find(begin,
+                                                     data.query.end(),
+                                                     search_state,
+                                                     data.actual_iterator_start,
+                                                     end,
+                                                     branch);
                 }
+            }
+
+            // Matches starting exactly at data.actual_iterator_start
+            constexpr __attribute__((always_inline)) void attempt() noexcept
+            {
+                data.accepted = true;
+
+                if constexpr (use_pike_vm)
+                {
+                    data.accepted = automata::pike_vm<matcher>::find(
+                        data.actual_iterator_start,
+                        data.query.end(),
+                        true,
+                        search_state,
+                        data.actual_iterator_start,
+                        data.actual_iterator_end,
+                        data.match_groups);
+                    return;
+                }
+
+                if constexpr (use_one_pass)
+                {
+                    const auto result = automata::one_pass<matcher>::match(
+                        data.actual_iterator_start,
+                        data.query.end(),
+                        data.actual_iterator_end,
+                        data.match_groups);
+
+                    if (result != automata::one_pass_result::ambiguous)
+                    {
+                        data.accepted
+                            = result == automata::one_pass_result::found;
+                        return;
+                    }
+                }
+
+                matcher::match(data);
+
+                // Whatever was found after running out is unreliable
+                if (data.steps.exhausted())
+                {
+                    data.accepted = false;
+                }
+            }
+
+            // Where to attempt next, after an attempt at start failed
+            constexpr __attribute__((always_inline)) auto
+                resume(const char* start) const noexcept -> const char*
+            {
+                constexpr auto& run    = analysis::leading_run<matcher>;
+                constexpr auto& shifts = analysis::prefix_shifts_v<matcher>;
+
+                auto next = start + 1;
+
+                if constexpr (shifts.prefix.size > 1)
+                {
+                    // As in KMP, starts that would overlap the bytes of
+                    // the prefix read at start in a different way
+                    // cannot match
+                    unsigned read = 0;
+
+                    while (read < shifts.prefix.size
+                           && start + read < data.query.end()
+                           && start[read] == shifts.prefix.chars[read])
+                    {
+                        ++read;
+                    }
+
+                    next = start + shifts.shift[read];
+                }
+
+                if constexpr (!run.empty())
+                {
+                    // Attempts inside the run consumed by the leading
+                    // loop fail the same way
+                    auto end = start;
+
+                    while (end < data.query.end()
+                           && run.contains(static_cast<unsigned char>(*end)))
+                    {
+                        ++end;
+                    }
+
+                    next = std::max(next, end);
+                }
+
+                return next;
+            }
+
+            constexpr __attribute__((always_inline)) void refill() noexcept
+            {
+                if constexpr (engines::is_budgeted<engine>)
+                {
+                    data.steps = {engine::steps};
+                }
+            }
+
+            constexpr __attribute__((always_inline)) void
+                attempt_at(const char* position) noexcept
+            {
+                data.actual_iterator_start = position;
+                data.actual_iterator_end   = position;
+                data.match_groups          = {};
+                attempt();
+            }
+
+            /*
+             * Moves the match found to the earliest start of a match
+             * ending where it does: the reverse automaton finds it at
+             * once, otherwise the positions before it are attempted
+             * while their match reaches that end
+             */
+            constexpr __attribute__((always_inline)) void
+                move_to_first_start(const char* begin) noexcept
+            {
+                const auto* candidate = data.actual_iterator_start;
+                const auto* end       = data.actual_iterator_end;
+
+                if constexpr (bounds_dfa::enabled)
+                {
+                    const auto* first
+                        = bounds_dfa::leftmost_start(begin, end);
+
+                    if (first < candidate)
+                    {
+                        attempt_at(first);
+                    }
+                }
+                else if (candidate != begin)
+                {
+                    auto first = candidate;
+
+                    do
+                    {
+                        attempt_at(first - 1);
+
+                        if (!data.accepted || data.actual_iterator_end < end)
+                        {
+                            break;
+                        }
+                    } while (--first != begin);
+
+                    attempt_at(first);
+                }
+            }
+
+            constexpr __attribute__((always_inline)) auto fail() noexcept
+                -> bool
+            {
+                data.actual_iterator_start = data.query.end();
+                data.actual_iterator_end   = data.query.end();
+                data.accepted              = false;
 
-                data.accepted = false;
                 return false;
             }
     };
@@ -201,23 +1014,30 @@ namespace e_regex
 // For structured decomposition
 namespace std
 {
-    template<typename matcher>
-    struct tuple_size<e_regex::match_result<matcher>>
+    template<typename matcher, typename Char_Type, typename engine>
+    struct tuple_size<e_regex::match_result<matcher, Char_Type, engine>>
     {
             static const unsigned value = matcher::groups + 1;
     };
 
-    template<std::size_t N, typename matcher, typename Char_Type>
-    struct tuple_element<N, e_regex::match_result<matcher, Char_Type>>
+    template<std::size_t N,
+             typename matcher,
+             typename Char_Type,
+             typename engine>
+    struct tuple_element<N,
+                         e_regex::match_result<matcher, Char_Type, engine>>
     {
             static_assert(N <= e_regex::nodes::group_getter<matcher>::value);
 
             using type = std::string_view;
     };
 
-    template<unsigned N, typename matcher>
+    template<unsigned N,
+             typename matcher,
+             typename Char_Type,
+             typename engine>
     constexpr __attribute__((always_inline)) auto
-        get(e_regex::match_result<matcher> t) noexcept
+        get(e_regex::match_result<matcher, Char_Type, engine> t) noexcept
     {
         return t.template get<N>();
     }
@@ -8,5 +8,6 @@
 #include "nodes/negated.hpp"
 #include "nodes/possessive.hpp"
 #include "nodes/repeated.hpp"
+#include "nodes/strip_groups.hpp"
 
 #endif /* NODES_HPP */
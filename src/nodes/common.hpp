@@ -91,6 +91,38 @@ namespace e_regex::nodes
             }
     };
 
+    /**
+     * @brief Runs node::backtrack, the continuation of a repetition,
+     * unless it already failed at the same position with the same
+     * injected children
+     *
+     * Only failures leaving the position unchanged are recorded, so
+     * skipping them leaves result as running them again would.
+     */
+    template<typename node, typename... injected_children>
+    constexpr __attribute__((always_inline)) auto
+        memoized_backtrack(auto& result) -> auto&
+    {
+        const auto begin = result.actual_iterator_end;
+
+        if (result.failures.template failed<node, injected_children...>(
+                begin))
+        {
+            result.accepted = false;
+            return result;
+        }
+
+        node::template backtrack<injected_children...>(result);
+
+        if (!result && result.actual_iterator_end == begin)
+        {
+            result.failures.template record<node, injected_children...>(
+                begin);
+        }
+
+        return result;
+    }
+
     template<typename nodes,
              typename terminals = std::tuple<>,
              typename others    = std::tuple<>>
@@ -116,6 +148,12 @@ namespace e_regex::nodes
             using _children = first_type<children>;
             using invoker   = invoke_match<injected_children>;
 
+            if (!match_result.steps.take())
+            {
+                match_result.accepted = false;
+                return match_result;
+            }
+
             if constexpr (std::tuple_size_v<children> == 1)
             {
                 return invoker::template match<typename _children::type>(
@@ -123,14 +161,19 @@ namespace e_regex::nodes
             }
             else
             {
+                const auto begin = match_result.actual_iterator_end;
+
                 if (invoker::template match<typename _children::type>(
                         match_result))
                 {
                     return match_result;
                 }
 
-                match_result.accepted = true;
-                return dfs<typename _children::remaining>(match_result);
+                // Every branch starts from the same position
+                match_result.actual_iterator_end = begin;
+                match_result.accepted            = true;
+                return dfs<typename _children::remaining, injected_children>(
+                    match_result);
             }
         }
     }
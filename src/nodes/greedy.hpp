@@ -150,18 +150,21 @@ namespace e_regex::nodes
                                           == matcher::meta.maximum_match_size)
                 {
                     // Optional node with a terminal matcher
-                    matcher::match(result);
+                    const auto begin = result.actual_iterator_end;
 
-                    if (!backtrack<injected_children...>(result)
-                        && result.actual_iterator_end
-                               > result.actual_iterator_start)
+                    if (matcher::match(result)
+                        && memoized_backtrack<greedy, injected_children...>(
+                            result))
                     {
-                        result.actual_iterator_end
-                            -= matcher::meta.minimum_match_size;
-                        backtrack<injected_children...>(result);
+                        return result;
                     }
 
-                    return result;
+                    // Retry skipping the optional match
+                    result.actual_iterator_end = begin;
+                    result.accepted            = true;
+
+                    return memoized_backtrack<greedy, injected_children...>(
+                        result);
                 }
                 else
                 {
@@ -197,7 +200,14 @@ namespace e_regex::nodes
                     // Now backtrack
                     while (repetitions > repetitions_min)
                     {
-                        if (backtrack<injected_children...>(result))
+                        if (!result.steps.take())
+                        {
+                            result.accepted = false;
+                            return result;
+                        }
+
+                        if (memoized_backtrack<greedy,
+                                               injected_children...>(result))
                         {
                             return result;
                         }
@@ -17,8 +17,10 @@ namespace e_regex::nodes
                 = '(' + matcher::expression + ')'
                   + get_children_expression<children...>();
 
-            using admission_set =
-                typename extract_admission_set<matcher>::type;
+            using admission_set = std::conditional_t<
+                matcher::meta.minimum_match_size == 0,
+                typename extract_admission_set<matcher, children...>::type,
+                typename extract_admission_set<matcher>::type>;
 
             static constexpr auto meta = e_regex::meta<admission_set> {
                 .policy_ = e_regex::policy::NONE,
@@ -60,6 +62,49 @@ namespace e_regex::nodes
                 return result;
             }
     };
+
+    /*
+     * Group whose match is not recorded: its children are still
+     * injected into matcher, so it matches as the capturing one
+     */
+    template<typename matcher, typename... children>
+    struct uncaptured_group : public base<matcher, children...>
+    {
+            static constexpr auto expression
+                = "(?:" + matcher::expression + ')'
+                  + get_children_expression<children...>();
+
+            using admission_set = std::conditional_t<
+                matcher::meta.minimum_match_size == 0,
+                typename extract_admission_set<matcher, children...>::type,
+                typename extract_admission_set<matcher>::type>;
+
+            static constexpr auto meta = e_regex::meta<admission_set> {
+                .policy_ = e_regex::policy::NONE,
+                .minimum_match_size = matcher::meta.minimum_match_size,
+                .maximum_match_size = matcher::meta.maximum_match_size};
+
+            template<typename... injected_children>
+            using optimize = uncaptured_group<
+                typename matcher::template optimize<children..., injected_children...>,
+                typename children::template optimize<>...>;
+
+            template<typename... injected_children>
+            static constexpr __attribute__((always_inline)) auto
+                match(auto& result) -> auto&
+            {
+                matcher::template match<children...>(result);
+
+                if (result)
+                {
+                    return dfs<std::tuple<children...>,
+                               std::tuple<children..., injected_children...>>(
+                        result);
+                }
+
+                return result;
+            }
+    };
 } // namespace e_regex::nodes
 
 #endif /* E_REGEX_NODES_GROUP_HPP_*/
@@ -104,6 +104,26 @@ namespace e_regex::nodes
                      repetitions_max,
                      typename children::template optimize<>...>>;
 
+            // Tries to end the repetition here
+            template<typename... injected_children>
+            static constexpr auto __attribute__((always_inline))
+            backtrack(auto& result) -> auto&
+            {
+                if constexpr (sizeof...(children) > 0)
+                {
+                    return dfs<std::tuple<children...>>(result);
+                }
+                else
+                {
+                    auto bak = result.actual_iterator_end;
+
+                    dfs<std::tuple<injected_children...>>(result);
+                    result.actual_iterator_end = bak;
+
+                    return result;
+                }
+            }
+
             template<typename... injected_children>
             static constexpr __attribute__((always_inline)) auto
                 match(auto& result) -> auto&
@@ -132,21 +152,22 @@ namespace e_regex::nodes
                     while (result.actual_iterator_end < result.query.end()
                            && matches < repetitions_max)
                     {
-                        if constexpr (sizeof...(children) > 0)
+                        if (!result.steps.take())
                         {
-                            dfs<std::tuple<children...>>(result);
+                            result.accepted = false;
+                            return result;
+                        }
+
+                        memoized_backtrack<lazy, injected_children...>(
+                            result);
 
+                        if constexpr (sizeof...(children) > 0)
+                        {
                             if (result)
                             {
                                 return result;
                             }
                         }
-                        else
-                        {
-                            auto bak = result.actual_iterator_end;
-                            dfs<std::tuple<injected_children...>>(result);
-                            result.actual_iterator_end = bak;
-                        }
 
                         if (!result)
                         {
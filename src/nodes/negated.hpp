@@ -38,8 +38,11 @@ namespace e_regex::nodes
                     return result;
                 }
 
+                const auto begin = result.actual_iterator_end;
+
                 matcher::match(result);
-                result.accepted = !result.accepted;
+                result.actual_iterator_end = begin;
+                result.accepted            = !result.accepted;
 
                 if (result)
                 {
@@ -0,0 +1,80 @@
+#ifndef E_REGEX_NODES_STRIP_GROUPS_HPP_
+#define E_REGEX_NODES_STRIP_GROUPS_HPP_
+
+#include "basic.hpp"
+#include "greedy.hpp"
+#include "group.hpp"
+#include "lazy.hpp"
+#include "negated.hpp"
+#include "possessive.hpp"
+#include "repeated.hpp"
+
+namespace e_regex::nodes
+{
+    // Terminals hold no groups
+    template<typename node>
+    struct strip_groups
+    {
+            using type = node;
+    };
+
+    template<typename node>
+    using strip_groups_t = typename strip_groups<node>::type;
+
+    template<typename matcher, typename... children>
+    struct strip_groups<simple<matcher, children...>>
+    {
+            using type = simple<strip_groups_t<matcher>,
+                                strip_groups_t<children>...>;
+    };
+
+    template<typename matcher, auto index, typename... children>
+    struct strip_groups<group<matcher, index, children...>>
+    {
+            using type = uncaptured_group<strip_groups_t<matcher>,
+                                          strip_groups_t<children>...>;
+    };
+
+    template<typename matcher, unsigned min, unsigned max, typename... children>
+    struct strip_groups<greedy<matcher, min, max, children...>>
+    {
+            using type = greedy<strip_groups_t<matcher>,
+                                min,
+                                max,
+                                strip_groups_t<children>...>;
+    };
+
+    template<typename matcher, unsigned min, unsigned max, typename... children>
+    struct strip_groups<lazy<matcher, min, max, children...>>
+    {
+            using type = lazy<strip_groups_t<matcher>,
+                              min,
+                              max,
+                              strip_groups_t<children>...>;
+    };
+
+    template<typename matcher, unsigned min, unsigned max, typename... children>
+    struct strip_groups<possessive<matcher, min, max, children...>>
+    {
+            using type = possessive<strip_groups_t<matcher>,
+                                    min,
+                                    max,
+                                    strip_groups_t<children>...>;
+    };
+
+    template<typename matcher, unsigned repetitions, typename... children>
+    struct strip_groups<repeated<matcher, repetitions, children...>>
+    {
+            using type = repeated<strip_groups_t<matcher>,
+                                  repetitions,
+                                  strip_groups_t<children>...>;
+    };
+
+    template<typename matcher>
+    struct strip_groups<negated_node<matcher>>
+    {
+            using type = negated_node<strip_groups_t<matcher>>;
+    };
+} // namespace e_regex::nodes
+
+#endif /* E_REGEX_NODES_STRIP_GROUPS_HPP_*/
@@ -1,6 +1,12 @@
 #ifndef E_REGEX_REGEX_HPP_
 #define E_REGEX_REGEX_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "engines.hpp"
 #include "match_result.hpp"
 #include "nodes/common.hpp"
 #include "tokenization/token.hpp"
@@ -31,16 +37,46 @@ namespace e_regex
         };
     } // namespace __private
 
-    template<static_string expression>
+    /*
+     * engine selects how matches are searched, see engines.hpp;
+     * match_prefix always runs the regex tree
+     */
+    template<static_string expression,
+             typename engine = engines::automatic>
     struct regex
     {
             using ast = typename __private::optimizer<
                 typename tree_builder<build_pack_string_t<expression>>::tree>::type;
 
+            // Same matches, without capture groups to record
+            using capture_free_ast = nodes::strip_groups_t<ast>;
+
             static constexpr __attribute__((always_inline)) auto
                 match(literal_string_view<> data)
             {
-                return match_result<ast> {data};
+                return match_result<ast, char, engine> {data};
+            }
+
+            /**
+             * @brief Matches data with the memoized engine, using
+             * scratch to remember failed repetitions
+             */
+            static constexpr __attribute__((always_inline)) auto
+                match(literal_string_view<> data, std::span<std::uint64_t> scratch)
+                requires std::is_same_v<engine, engines::memoized>
+            {
+                return match_result<ast, char, engine> {data, scratch};
+            }
+
+            /**
+             * @brief Words of scratch the memoized engine needs for
+             * data of size bytes
+             */
+            static constexpr __attribute__((always_inline)) auto
+                scratch_size(std::size_t size) noexcept -> std::size_t
+                requires std::is_same_v<engine, engines::memoized>
+            {
+                return failure_memo<ast>::words(size);
             }
 
             constexpr __attribute__((always_inline)) auto
@@ -49,6 +85,103 @@ namespace e_regex
                 return match(data);
             }
 
+            /**
+             * @brief Matches only at the beginning of data, running
+             * the regex tree exactly once
+             */
+            static constexpr __attribute__((always_inline)) auto
+                match_prefix(literal_string_view<> data)
+            {
+                return match_result<ast, char, engine> {data, false};
+            }
+
+            /**
+             * @brief match_prefix with the scratch of the memoized
+             * engine
+             */
+            static constexpr __attribute__((always_inline)) auto
+                match_prefix(literal_string_view<>    data,
+                             std::span<std::uint64_t> scratch)
+                requires std::is_same_v<engine, engines::memoized>
+            {
+                return match_result<ast, char, engine> {data, scratch, false};
+            }
+
+            /**
+             * @brief Matches only if the match found at the beginning
+             * of data spans all of it
+             */
+            static constexpr __attribute__((always_inline)) auto
+                full_match(literal_string_view<> data)
+            {
+                return match_result<ast, char, engine>::full_match(data);
+            }
+
+            /**
+             * @brief The match starting at the last position of data
+             * where one starts, searched from the end
+             *
+             * Unlike the last match found by next(), it can overlap
+             * an earlier match: in "12-", the last match of \d+- is
+             * "2-".
+             */
+            static constexpr __attribute__((always_inline)) auto
+                find_last(literal_string_view<> data)
+            {
+                return match_result<ast, char, engine>::find_last(data);
+            }
+
+            /**
+             * @brief True if data contains a match, searched without
+             * recording groups
+             */
+            static constexpr __attribute__((always_inline)) auto
+                contains(literal_string_view<> data) -> bool
+            {
+                return match_result<capture_free_ast, char, engine>::contains(
+                    data);
+            }
+
+            /**
+             * @brief Number of matches in data, iterated as with next()
+             * but without recording groups
+             */
+            static constexpr __attribute__((always_inline)) auto
+                count(literal_string_view<> data) -> std::size_t
+            {
+                std::size_t result = 0;
+
+                for (auto match = match_result<capture_free_ast, char, engine> {
+                         data};
+                     match;
+                     match.next())
+                {
+                    ++result;
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Cache counters of the lazy DFA engine, for the
+             * calling thread
+             */
+            static auto cache_statistics() noexcept
+                -> automata::cache_statistics
+                requires engines::is_lazy_dfa<engine>
+            {
+                using lazy_dfa = automata::lazy_dfa<ast, engine::states>;
+
+                if constexpr (lazy_dfa::enabled)
+                {
+                    return lazy_dfa::statistics();
+                }
+                else
+                {
+                    return {};
+                }
+            }
+
             static __attribute__((always_inline)) constexpr auto
                 get_expression()
             {
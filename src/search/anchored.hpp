@@ -0,0 +1,32 @@
+#ifndef E_REGEX_SEARCH_ANCHORED_HPP_
+#define E_REGEX_SEARCH_ANCHORED_HPP_
+
+#include "analysis/anchors.hpp"
+
+namespace e_regex::search
+{
+    /*
+     * A pattern rooted in ^ can only match at the beginning of the
+     * query, which is attempted before any search: no later position
+     * is a candidate.
+     */
+    template<typename matcher>
+    struct anchored
+    {
+            static constexpr bool enabled
+                = analysis::starts_with_anchor<matcher>;
+
+            struct state
+            {};
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* /*begin*/,
+                     const char* end,
+                     state& /*state*/) noexcept -> const char*
+            {
+                return end;
+            }
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_ANCHORED_HPP_*/
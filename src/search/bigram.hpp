@@ -0,0 +1,153 @@
+#ifndef E_REGEX_SEARCH_BIGRAM_HPP_
+#define E_REGEX_SEARCH_BIGRAM_HPP_
+
+#include <array>
+
+#include "analysis/anchors.hpp"
+#include "automata/position_automaton.hpp"
+#include "first_byte.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::search
+{
+    namespace __private
+    {
+        // pairs[c] holds the bytes that can follow c at a match start
+        struct bigram_table
+        {
+                std::array<byte_set, 256> pairs = {};
+
+                // First bytes of one-byte matches
+                byte_set single;
+
+                unsigned size = 0;
+        };
+
+        template<typename matcher>
+        constexpr auto make_bigram_table() -> bigram_table
+        {
+            const auto automaton
+                = automata::make_position_automaton<matcher>();
+
+            bigram_table result;
+
+            for (const auto p: automaton.first)
+            {
+                if (p < 0)
+                {
+                    continue;
+                }
+
+                const auto& position
+                    = automaton.positions[static_cast<unsigned>(p)];
+
+                byte_set second;
+                bool     ends = false;
+
+                for (const auto q: position.follow)
+                {
+                    if (q < 0)
+                    {
+                        // A match can end after one byte, anything
+                        // follows it
+                        second = ~byte_set {};
+                        ends   = true;
+                        break;
+                    }
+
+                    second = second
+                             | automaton.positions[static_cast<unsigned>(q)]
+                                   .bytes;
+                }
+
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    if (!position.bytes.contains(c))
+                    {
+                        continue;
+                    }
+
+                    result.pairs[c] = result.pairs[c] | second;
+
+                    if (ends)
+                    {
+                        result.single.insert(static_cast<unsigned char>(c));
+                    }
+                }
+            }
+
+            for (const auto& pair: result.pairs)
+            {
+                result.size += pair.size();
+            }
+
+            return result;
+        }
+    } // namespace __private
+
+    /*
+     * Skips every position whose first two bytes cannot start a match,
+     * a bit per pair of bytes. It replaces first_byte when the first
+     * byte alone lets through many more positions than the pair, as
+     * for [a-z]\d+, whose first byte is found all over plain text.
+     */
+    template<typename matcher>
+    struct bigram
+    {
+        private:
+            static constexpr bool supported
+                = !analysis::has_anchor<matcher>
+                  && automata::position_count<matcher>
+                         <= automata::max_positions;
+
+            static constexpr auto table = [] {
+                if constexpr (supported)
+                {
+                    return __private::make_bigram_table<matcher>();
+                }
+                else
+                {
+                    return __private::bigram_table {};
+                }
+            }();
+
+        public:
+            // At most a quarter of the pairs the first byte admits
+            static constexpr bool enabled
+                = supported && first_byte<matcher>::enabled
+                  && table.size * 4 <= first_byte<matcher>::set.size() * 256;
+
+            struct state
+            {};
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin,
+                     const char* end,
+                     state& /*state*/) noexcept -> const char*
+            {
+                const auto* current = first_byte<matcher>::find(begin, end);
+
+                for (; current + 1 < end;
+                     current = first_byte<matcher>::find(current + 1, end))
+                {
+                    if (table.pairs[static_cast<unsigned char>(current[0])]
+                            .contains(static_cast<unsigned char>(current[1])))
+                    {
+                        return current;
+                    }
+                }
+
+                // Only a one-byte match fits before the end
+                if (current + 1 == end
+                    && table.single.contains(
+                        static_cast<unsigned char>(*current)))
+                {
+                    return current;
+                }
+
+                return end;
+            }
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_BIGRAM_HPP_*/
@@ -0,0 +1,116 @@
+#ifndef E_REGEX_SEARCH_BNDM_HPP_
+#define E_REGEX_SEARCH_BNDM_HPP_
+
+#include <array>
+#include <cstdint>
+
+#include "analysis/class_sequence.hpp"
+
+namespace e_regex::search
+{
+    namespace __private
+    {
+        // Bit size - 1 - i of masks[c] is set if position i admits c
+        template<typename matcher>
+        constexpr auto make_bndm_masks() noexcept
+            -> std::array<std::uint64_t, 256>
+        {
+            constexpr auto& sequence = analysis::class_sequence_v<matcher>;
+
+            std::array<std::uint64_t, 256> result = {};
+
+            for (unsigned i = 0; i < sequence.size; ++i)
+            {
+                const auto bit = std::uint64_t {1} << (sequence.size - 1 - i);
+
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    if (sequence.bytes[i].contains(c))
+                    {
+                        result[c] |= bit;
+                    }
+                }
+            }
+
+            return result;
+        }
+    } // namespace __private
+
+    /*
+     * The regex is a long sequence of byte sets, none optional, so
+     * every match has the same width: BNDM reads each window backwards
+     * from its last byte, tracking the pieces of the sequence that end
+     * there, and shifts it past the bytes that cannot begin a match.
+     * A byte no position admits moves the window by its whole width.
+     */
+    template<typename matcher>
+    struct bndm
+    {
+            static constexpr auto& sequence
+                = analysis::class_sequence_v<matcher>;
+
+            // Shift-And is faster on short windows, or when its first
+            // position is a few bytes found with memchr-like scans
+            static constexpr bool enabled
+                = sequence.valid && sequence.optional == 0
+                  && sequence.size >= 4 && sequence.bytes[0].size() > 3;
+
+            struct state
+            {};
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin,
+                     const char* end,
+                     state& /*state*/) noexcept -> const char*
+            {
+                for (const auto* window = begin; end - window >= width;)
+                {
+                    auto     active = ~std::uint64_t {0};
+                    unsigned shift  = width;
+
+                    for (auto j = width; active != 0;)
+                    {
+                        active &= masks[static_cast<unsigned char>(
+                            window[--j])];
+
+                        if ((active & prefix) != 0)
+                        {
+                            if (j == 0)
+                            {
+                                return window;
+                            }
+
+                            // A match can start at the byte just read
+                            shift = j;
+                        }
+
+                        active <<= 1U;
+                    }
+
+                    window += shift;
+                }
+
+                return end;
+            }
+
+        private:
+            static constexpr unsigned width = sequence.size;
+
+            // The bytes read so far begin the sequence
+            static constexpr auto prefix = std::uint64_t {1}
+                                           << (enabled ? width - 1 : 0);
+
+            static constexpr auto masks = [] {
+                if constexpr (enabled)
+                {
+                    return __private::make_bndm_masks<matcher>();
+                }
+                else
+                {
+                    return std::array<std::uint64_t, 256> {};
+                }
+            }();
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_BNDM_HPP_*/
@@ -0,0 +1,346 @@
+#ifndef E_REGEX_SEARCH_BYTE_SCAN_HPP_
+#define E_REGEX_SEARCH_BYTE_SCAN_HPP_
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::search
+{
+    namespace __private
+    {
+        using vector = unsigned char __attribute__((vector_size(16)));
+
+        inline constexpr auto vector_size = sizeof(vector);
+
+        inline __attribute__((always_inline)) auto
+            load(const char* data) noexcept -> vector
+        {
+            vector result;
+            std::memcpy(&result, data, sizeof(vector));
+
+            return result;
+        }
+
+        inline __attribute__((always_inline)) auto
+            splat(unsigned char c) noexcept -> vector
+        {
+            return vector {} + c;
+        }
+
+        // One bit per lane of a comparison mask
+        inline __attribute__((always_inline)) auto
+            mask_bits(vector mask) noexcept -> unsigned
+        {
+#if defined(__SSE2__)
+            using signed_vector = char __attribute__((vector_size(16)));
+
+            return static_cast<unsigned>(__builtin_ia32_pmovmskb128(
+                std::bit_cast<signed_vector>(mask)));
+#else
+            unsigned result = 0;
+
+            for (unsigned i = 0; i < vector_size; ++i)
+            {
+                result |= static_cast<unsigned>(mask[i] & 1U) << i;
+            }
+
+            return result;
+#endif
+        }
+
+        // Index of the first lane set in a comparison mask, or
+        // vector_size if there is none
+        inline __attribute__((always_inline)) auto
+            first_lane(vector mask) noexcept -> unsigned
+        {
+            const auto bits = mask_bits(mask);
+
+            return bits == 0 ? vector_size : std::countr_zero(bits);
+        }
+
+#if defined(__SSSE3__)
+        inline constexpr bool has_shuffle = true;
+#else
+        inline constexpr bool has_shuffle = false;
+#endif
+
+#if defined(__SSSE3__)
+        // Lane i of the result is table[indices[i] & 15]
+        inline __attribute__((always_inline)) auto
+            shuffle(vector table, vector indices) noexcept -> vector
+        {
+            using signed_vector = char __attribute__((vector_size(16)));
+
+            return std::bit_cast<vector>(__builtin_ia32_pshufb128(
+                std::bit_cast<signed_vector>(table),
+                std::bit_cast<signed_vector>(indices & splat(15))));
+        }
+#endif
+
+        template<const byte_set& set>
+        constexpr __attribute__((always_inline)) auto
+            scalar_find(const char* begin, const char* end) noexcept
+            -> const char*
+        {
+            while (begin < end
+                   && !set.contains(static_cast<unsigned char>(*begin)))
+            {
+                ++begin;
+            }
+
+            return begin;
+        }
+
+        // Runs every lane through classify, 16 bytes at a time
+        template<const byte_set& set>
+        __attribute__((always_inline)) inline auto
+            vector_find(const char* begin,
+                        const char* end,
+                        auto        classify) noexcept -> const char*
+        {
+            while (end - begin >= static_cast<long>(vector_size))
+            {
+                const auto lane = first_lane(classify(load(begin)));
+
+                if (lane != vector_size)
+                {
+                    return begin + lane;
+                }
+
+                begin += vector_size;
+            }
+
+            return scalar_find<set>(begin, end);
+        }
+
+        // Bounds of the n-th run of contiguous bytes in set
+        template<const byte_set& set, unsigned n>
+        consteval auto range() -> std::array<unsigned char, 2>
+        {
+            unsigned current = 0;
+
+            for (unsigned c = 0; c < 256; ++c)
+            {
+                if (set.contains(c) && (c == 0 || !set.contains(c - 1))
+                    && current++ == n)
+                {
+                    auto last = c;
+                    while (last < 255 && set.contains(last + 1))
+                    {
+                        ++last;
+                    }
+
+                    return {static_cast<unsigned char>(c),
+                            static_cast<unsigned char>(last)};
+                }
+            }
+
+            return {};
+        }
+
+        template<const byte_set& set, unsigned... ranges>
+        __attribute__((always_inline)) inline auto
+            classify_ranges(vector                                  data,
+                            std::integer_sequence<unsigned, ranges...>)
+                -> vector
+        {
+            // Unsigned wrap-around turns each range check into a
+            // single comparison
+            return std::bit_cast<vector>(
+                (... | (data - splat(range<set, ranges>()[0])
+                         <= splat(range<set, ranges>()[1]
+                                  - range<set, ranges>()[0]))));
+        }
+
+        // Above this amount of ranges the nibble tables are cheaper
+        inline constexpr auto max_vector_ranges = 6U;
+
+#if defined(__SSSE3__)
+        // Bit h % 8 of low[l] (h < 8) or high[l] (h >= 8) is set if
+        // the byte with high nibble h and low nibble l is in set
+        struct nibble_tables
+        {
+                std::array<unsigned char, 16> low  = {};
+                std::array<unsigned char, 16> high = {};
+                std::array<unsigned char, 16> bits = {};
+        };
+
+        template<const byte_set& set>
+        consteval auto make_nibble_tables() -> nibble_tables
+        {
+            nibble_tables result;
+
+            for (unsigned c = 0; c < 256; ++c)
+            {
+                const auto high_nibble = c >> 4U;
+                const auto bit = static_cast<unsigned char>(
+                    1U << (high_nibble & 7U));
+
+                result.bits[high_nibble] = bit;
+
+                if (set.contains(c))
+                {
+                    auto& row = high_nibble < 8 ? result.low : result.high;
+                    row[c & 15U] |= bit;
+                }
+            }
+
+            return result;
+        }
+
+        template<const byte_set& set>
+        __attribute__((always_inline)) inline auto
+            classify_table(vector data) noexcept -> vector
+        {
+            static constexpr auto tables = make_nibble_tables<set>();
+
+            // Low nibbles pick the row of each lane, high nibbles its
+            // bit
+            const auto high_nibbles = data >> 4;
+            const auto low_half
+                = std::bit_cast<vector>(high_nibbles < splat(8));
+            const auto rows
+                = (shuffle(std::bit_cast<vector>(tables.low), data)
+                   & low_half)
+                  | (shuffle(std::bit_cast<vector>(tables.high), data)
+                     & ~low_half);
+
+            return std::bit_cast<vector>(
+                (rows & shuffle(std::bit_cast<vector>(tables.bits),
+                                high_nibbles))
+                != vector {});
+        }
+#endif
+
+        // True if classify checks set with a few operations per lane
+        template<const byte_set& set>
+        inline constexpr bool vector_classified
+            = set.size() <= 3 || set.ranges() <= max_vector_ranges
+              || has_shuffle;
+
+        // Lanes of data whose byte belongs to set
+        template<const byte_set& set>
+        __attribute__((always_inline)) inline auto
+            classify(vector data) noexcept -> vector
+        {
+            static_assert(vector_classified<set>);
+
+            if constexpr (set.size() <= 3)
+            {
+                constexpr auto first  = set.at(0);
+                constexpr auto second = set.at(set.size() > 1 ? 1 : 0);
+                constexpr auto last   = set.at(set.size() - 1);
+
+                return std::bit_cast<vector>((data == splat(first))
+                                             | (data == splat(second))
+                                             | (data == splat(last)));
+            }
+            else if constexpr (set.ranges() <= max_vector_ranges)
+            {
+                return classify_ranges<set>(
+                    data,
+                    std::make_integer_sequence<unsigned, set.ranges()> {});
+            }
+#if defined(__SSSE3__)
+            else
+            {
+                return classify_table<set>(data);
+            }
+#endif
+        }
+    } // namespace __private
+
+    /**
+     * @brief Finds the first byte of [begin, end) that belongs to set
+     *
+     * @return end if there is none
+     */
+    // set is taken by reference: some compilers mangle array members
+    // of class template arguments ambiguously
+    template<const byte_set& set>
+    constexpr __attribute__((always_inline)) auto
+        find_first_of(const char* begin, const char* end) noexcept
+        -> const char*
+    {
+        using namespace __private;
+
+        if (std::is_constant_evaluated() || begin >= end
+            || set.contains(static_cast<unsigned char>(*begin)))
+        {
+            // Dense sets often hit right away, skip the setup
+            return scalar_find<set>(begin, end);
+        }
+        else if constexpr (set.size() == 1)
+        {
+            const auto* result = std::memchr(begin, set.at(0), end - begin);
+
+            return result == nullptr ? end
+                                     : static_cast<const char*>(result);
+        }
+        else if constexpr (vector_classified<set>)
+        {
+            return vector_find<set>(begin, end, [](vector data) {
+                return classify<set>(data);
+            });
+        }
+        else
+        {
+            return scalar_find<set>(begin, end);
+        }
+    }
+
+    /**
+     * @brief Finds the last byte of [begin, end) that belongs to set
+     *
+     * @return end if there is none
+     */
+    template<const byte_set& set>
+    constexpr __attribute__((always_inline)) auto
+        find_last_of(const char* begin, const char* end) noexcept
+        -> const char*
+    {
+        using namespace __private;
+
+        auto current = end;
+
+        if constexpr (vector_classified<set>)
+        {
+            if (!std::is_constant_evaluated() && begin < end
+                && !set.contains(static_cast<unsigned char>(end[-1])))
+            {
+                while (current - begin >= static_cast<long>(vector_size))
+                {
+                    current -= vector_size;
+
+                    const auto bits
+                        = mask_bits(classify<set>(load(current)));
+
+                    if (bits != 0)
+                    {
+                        return current + std::bit_width(bits) - 1;
+                    }
+                }
+            }
+        }
+
+        while (current != begin)
+        {
+            --current;
+
+            if (set.contains(static_cast<unsigned char>(*current)))
+            {
+                return current;
+            }
+        }
+
+        return end;
+    }
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_BYTE_SCAN_HPP_*/
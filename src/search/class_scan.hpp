@@ -0,0 +1,292 @@
+#ifndef E_REGEX_SEARCH_CLASS_SCAN_HPP_
+#define E_REGEX_SEARCH_CLASS_SCAN_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "analysis/class_sequence.hpp"
+#include "byte_scan.hpp"
+
+namespace e_regex::search
+{
+    namespace __private
+    {
+        // Distinct byte sets of a class sequence
+        struct class_kinds
+        {
+                std::array<byte_set, analysis::max_class_sequence> sets
+                    = {};
+
+                // Kind of each position
+                std::array<unsigned, analysis::max_class_sequence> of = {};
+
+                // Bit i of positions[k] is set if position i has kind k
+                std::array<std::uint64_t, analysis::max_class_sequence>
+                    positions = {};
+
+                unsigned size = 0;
+        };
+
+        constexpr auto make_class_kinds(
+            const analysis::class_sequence& sequence) noexcept -> class_kinds
+        {
+            class_kinds result;
+
+            for (unsigned i = 0; i < sequence.size; ++i)
+            {
+                unsigned k = 0;
+                while (k < result.size
+                       && !(result.sets[k] == sequence.bytes[i]))
+                {
+                    ++k;
+                }
+
+                if (k == result.size)
+                {
+                    result.sets[result.size++] = sequence.bytes[i];
+                }
+
+                result.of[i] = k;
+                result.positions[k] |= std::uint64_t {1} << i;
+            }
+
+            return result;
+        }
+
+        // Bytes classified at once
+        inline constexpr auto class_block = 4 * vector_size;
+
+#if defined(__SSE2__)
+        inline constexpr bool has_movemask = true;
+#else
+        inline constexpr bool has_movemask = false;
+#endif
+    } // namespace __private
+
+    /*
+     * The regex is a short sequence of byte sets, none optional: each
+     * distinct set classifies a block of 64 bytes once, a bit per
+     * byte. Shifting the mask of each position back by its offset and
+     * intersecting them all gives every match start of the block at
+     * once. The same masks validate a whole input against the
+     * sequence, 16 bytes at a time.
+     */
+    template<typename matcher>
+    struct class_scan
+    {
+            static constexpr auto& sequence
+                = analysis::class_sequence_v<matcher>;
+
+            static constexpr auto kinds
+                = __private::make_class_kinds(sequence);
+
+        private:
+            template<unsigned k>
+            static constexpr auto kind_set = kinds.sets[k];
+
+            static constexpr bool classified = []<unsigned... k>(
+                std::integer_sequence<unsigned, k...>) {
+                return (__private::vector_classified<kind_set<k>> && ...);
+            }(std::make_integer_sequence<unsigned, kinds.size> {});
+
+        public:
+            // Each block holds more starts than a vector
+            static constexpr bool enabled
+                = __private::has_movemask && sequence.valid
+                  && sequence.optional == 0
+                  && sequence.size > 1
+                  && sequence.size + __private::vector_size
+                         <= __private::class_block
+                  && classified;
+
+            struct state
+            {
+                    // Block scanned last and the starts found in it
+                    const char*   block  = nullptr;
+                    std::uint64_t starts = 0;
+            };
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin, const char* end, state& state) noexcept
+                -> const char*
+            {
+                if (std::is_constant_evaluated())
+                {
+                    return scalar_find(begin, end);
+                }
+
+                if (state.block != nullptr && begin >= state.block
+                    && begin - state.block < stride)
+                {
+                    // Starts before begin were already returned
+                    const auto skipped = static_cast<unsigned>(
+                        begin - state.block);
+                    const auto starts
+                        = state.starts & (~std::uint64_t {0} << skipped);
+
+                    if (starts != 0)
+                    {
+                        const auto* start
+                            = state.block + std::countr_zero(starts);
+
+                        // The block may reach past a shorter end
+                        return end - start >= width ? start : end;
+                    }
+
+                    begin = state.block + stride;
+                }
+
+                for (; end - begin >= block_size; begin += stride)
+                {
+                    const auto starts = block_starts(begin);
+
+                    if (starts != 0)
+                    {
+                        state = {begin, starts};
+
+                        return begin + std::countr_zero(starts);
+                    }
+                }
+
+                return scalar_find(begin, end);
+            }
+
+            /**
+             * @brief True if [begin, end) is a match of the sequence
+             */
+            static constexpr __attribute__((always_inline)) auto
+                matches(const char* begin, const char* end) noexcept -> bool
+            {
+                if (end - begin != width)
+                {
+                    return false;
+                }
+
+                if (std::is_constant_evaluated()
+                    || width < static_cast<long>(__private::vector_size))
+                {
+                    return matches_at(begin);
+                }
+
+                constexpr long size = __private::vector_size;
+
+                for (long offset = 0; offset < width; offset += size)
+                {
+                    // The last vector overlaps the one before it
+                    const auto at = std::min(offset, width - size);
+
+                    if (lanes(begin + at, at) != 0xFFFFU)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+        private:
+            static constexpr long width      = sequence.size;
+            static constexpr long block_size = __private::class_block;
+
+            // Starts of a block whose match fits in it
+            static constexpr long stride = block_size - width + 1;
+
+            static constexpr auto valid_starts
+                = stride >= 64 ? ~std::uint64_t {0}
+                               : (std::uint64_t {1} << stride) - 1;
+
+            static constexpr auto matches_at(const char* begin) noexcept
+                -> bool
+            {
+                for (unsigned i = 0; i < width; ++i)
+                {
+                    if (!sequence.bytes[i].contains(
+                            static_cast<unsigned char>(begin[i])))
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            static constexpr auto scalar_find(const char* begin,
+                                              const char* end) noexcept
+                -> const char*
+            {
+                for (; end - begin >= width; ++begin)
+                {
+                    if (matches_at(begin))
+                    {
+                        return begin;
+                    }
+                }
+
+                return end;
+            }
+
+            // Bit j is set if byte j of the block has kind k
+            template<unsigned k>
+            static __attribute__((always_inline)) auto
+                kind_mask(const char* block) noexcept -> std::uint64_t
+            {
+                using namespace __private;
+
+                std::uint64_t result = 0;
+
+                for (unsigned i = 0; i < class_block / vector_size; ++i)
+                {
+                    result |= std::uint64_t {mask_bits(classify<kind_set<k>>(
+                                  load(block + i * vector_size)))}
+                              << (i * vector_size);
+                }
+
+                return result;
+            }
+
+            static __attribute__((always_inline)) auto
+                block_starts(const char* block) noexcept -> std::uint64_t
+            {
+                const auto masks = [block]<unsigned... k>(
+                    std::integer_sequence<unsigned, k...>) {
+                    return std::array<std::uint64_t, kinds.size> {
+                        kind_mask<k>(block)...};
+                }(std::make_integer_sequence<unsigned, kinds.size> {});
+
+                auto starts = valid_starts;
+
+                for (unsigned i = 0; i < width && starts != 0; ++i)
+                {
+                    starts &= masks[kinds.of[i]] >> i;
+                }
+
+                return starts;
+            }
+
+            // Lanes of the vector at offset whose byte the position of
+            // the sequence there admits
+            static __attribute__((always_inline)) auto
+                lanes(const char* data, long offset) noexcept
+                -> unsigned
+            {
+                using namespace __private;
+
+                const auto bytes = load(data);
+
+                return [bytes, offset]<unsigned... k>(
+                           std::integer_sequence<unsigned, k...>) {
+                    return (0U | ...
+                            | (mask_bits(classify<kind_set<k>>(bytes))
+                               & static_cast<unsigned>(
+                                   kinds.positions[k] >> offset)));
+                }(std::make_integer_sequence<unsigned, kinds.size> {})
+                       & 0xFFFFU;
+            }
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_CLASS_SCAN_HPP_*/
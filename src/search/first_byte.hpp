@@ -0,0 +1,69 @@
+#ifndef E_REGEX_SEARCH_FIRST_BYTE_HPP_
+#define E_REGEX_SEARCH_FIRST_BYTE_HPP_
+
+#include "byte_scan.hpp"
+#include "nodes/common.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::search
+{
+    // Skips every position whose byte cannot start a match
+    template<typename matcher>
+    struct first_byte
+    {
+            static constexpr auto set = byte_set::from_admitted_set<
+                typename nodes::extract_admission_set<matcher>::type>();
+
+            // An expression accepting the empty string can match
+            // anywhere
+            static constexpr bool enabled
+                = matcher::meta.minimum_match_size > 0 && !set.full();
+
+            struct state
+            {};
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin, const char* end) noexcept
+                -> const char*
+            {
+                if constexpr (enabled)
+                {
+                    return find_first_of<set>(begin, end);
+                }
+                else
+                {
+                    return begin;
+                }
+            }
+
+            /**
+             * @brief Last position of [begin, end) whose byte can start
+             * a match
+             *
+             * @return end if there is none
+             */
+            static constexpr __attribute__((always_inline)) auto
+                find_last(const char* begin, const char* end) noexcept
+                -> const char*
+            {
+                if constexpr (enabled)
+                {
+                    return find_last_of<set>(begin, end);
+                }
+                else
+                {
+                    return begin == end ? end : end - 1;
+                }
+            }
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin,
+                     const char* end,
+                     state& /*state*/) noexcept -> const char*
+            {
+                return find(begin, end);
+            }
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_FIRST_BYTE_HPP_*/
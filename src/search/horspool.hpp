@@ -0,0 +1,80 @@
+#ifndef E_REGEX_SEARCH_HORSPOOL_HPP_
+#define E_REGEX_SEARCH_HORSPOOL_HPP_
+
+#include <array>
+#include <cstddef>
+
+namespace e_regex::search
+{
+    namespace __private
+    {
+        // How far the needle can be moved when the byte under its
+        // last position is c
+        template<const auto& needle>
+        inline constexpr auto horspool_shifts = [] {
+            std::array<unsigned, 256> result {};
+            result.fill(needle.size);
+
+            for (unsigned i = 0; i + 1 < needle.size; ++i)
+            {
+                result[static_cast<unsigned char>(needle.chars[i])]
+                    = needle.size - 1 - i;
+            }
+
+            return result;
+        }();
+
+        template<const auto& needle>
+        constexpr __attribute__((always_inline)) auto
+            matches_at(const char* position) noexcept -> bool
+        {
+            for (unsigned i = 0; i < needle.size; ++i)
+            {
+                if (position[i] != needle.chars[i])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    } // namespace __private
+
+    /**
+     * @brief Finds the first occurrence of needle in [begin, end)
+     * with the Boyer-Moore-Horspool algorithm
+     *
+     * The shift table is computed at compile time, so the search is
+     * usable in constant evaluation too.
+     *
+     * @return end if there is none
+     */
+    template<const auto& needle>
+    constexpr auto find_horspool(const char* begin,
+                                 const char* end) noexcept -> const char*
+    {
+        using namespace __private;
+
+        constexpr auto size = std::size_t {needle.size};
+        constexpr auto tail = needle.chars[size - 1];
+
+        const auto length = static_cast<std::size_t>(end - begin);
+
+        for (std::size_t position = 0; position + size <= length;)
+        {
+            const auto current = begin[position + size - 1];
+
+            if (current == tail && matches_at<needle>(begin + position))
+            {
+                return begin + position;
+            }
+
+            position += horspool_shifts<needle>[static_cast<unsigned char>(
+                current)];
+        }
+
+        return end;
+    }
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_HORSPOOL_HPP_*/
@@ -0,0 +1,35 @@
+#ifndef E_REGEX_SEARCH_LITERAL_PREFIX_HPP_
+#define E_REGEX_SEARCH_LITERAL_PREFIX_HPP_
+
+#include "analysis/literal.hpp"
+#include "substring.hpp"
+
+namespace e_regex::search
+{
+    // Every match starts with a literal: its occurrences are the only
+    // candidate starts
+    template<typename matcher>
+    struct literal_prefix
+    {
+            static constexpr auto summary
+                = analysis::literal_summary_v<matcher>;
+            static constexpr auto needle = summary.required;
+
+            // Only when the best literal starts every match
+            static constexpr bool enabled
+                = needle.size > 1 && summary.required_maximum_offset == 0;
+
+            struct state
+            {};
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin,
+                     const char* end,
+                     state& /*state*/) noexcept -> const char*
+            {
+                return find_substring<needle>(begin, end);
+            }
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_LITERAL_PREFIX_HPP_*/
@@ -0,0 +1,101 @@
+#ifndef E_REGEX_SEARCH_REQUIRED_LITERAL_HPP_
+#define E_REGEX_SEARCH_REQUIRED_LITERAL_HPP_
+
+#include "analysis/literal.hpp"
+#include "first_byte.hpp"
+#include "substring.hpp"
+
+namespace e_regex::search
+{
+    /*
+     * Finds a literal that every match must contain, then looks for
+     * the start of a match only in the window of positions from
+     * which that occurrence is reachable.
+     */
+    template<typename matcher>
+    struct required_literal
+    {
+            static constexpr auto summary
+                = analysis::literal_summary_v<matcher>;
+
+            static constexpr auto needle = summary.required;
+
+            static constexpr bool enabled = needle.size > 0;
+
+            struct state
+            {
+                    // Last occurrence found and the first position
+                    // that can reach it
+                    const char* hit          = nullptr;
+                    const char* window_begin = nullptr;
+            };
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin, const char* end, state& state) noexcept
+                -> const char*
+            {
+                constexpr auto minimum_offset = summary.required_minimum_offset;
+
+                while (end - begin >= static_cast<long>(summary.minimum))
+                {
+                    if (state.hit == nullptr
+                        || state.hit - begin
+                               < static_cast<long>(minimum_offset))
+                    {
+                        state.hit = find_substring<needle>(
+                            begin + minimum_offset, end);
+
+                        if (state.hit == end)
+                        {
+                            return end;
+                        }
+
+                        state.window_begin = window_begin(begin, state.hit);
+                    }
+
+                    const auto* lower = begin < state.window_begin
+                                            ? state.window_begin
+                                            : begin;
+                    const auto* limit = state.hit - minimum_offset + 1;
+                    const auto* candidate
+                        = first_byte<matcher>::find(lower, limit);
+
+                    if (candidate < limit)
+                    {
+                        return candidate;
+                    }
+
+                    // No match can reach this occurrence
+                    begin = limit;
+                }
+
+                return end;
+            }
+
+        private:
+            static constexpr __attribute__((always_inline)) auto
+                window_begin(const char* begin, const char* hit) noexcept
+                -> const char*
+            {
+                constexpr auto maximum_offset = summary.required_maximum_offset;
+
+                if (maximum_offset != analysis::unbounded
+                    && hit - begin > static_cast<long>(maximum_offset))
+                {
+                    begin = hit - maximum_offset;
+                }
+
+                // Only bytes in before can precede the literal
+                while (hit > begin
+                       && summary.before.contains(
+                           static_cast<unsigned char>(hit[-1])))
+                {
+                    --hit;
+                }
+
+                return hit;
+            }
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_REQUIRED_LITERAL_HPP_*/
@@ -0,0 +1,46 @@
+#ifndef E_REGEX_SEARCH_SEARCHER_HPP_
+#define E_REGEX_SEARCH_SEARCHER_HPP_
+
+#include <type_traits>
+
+#include "anchored.hpp"
+#include "bigram.hpp"
+#include "bndm.hpp"
+#include "class_scan.hpp"
+#include "first_byte.hpp"
+#include "literal_prefix.hpp"
+#include "required_literal.hpp"
+#include "shift_and.hpp"
+#include "teddy.hpp"
+
+namespace e_regex::search
+{
+    // The strategy used to find candidate match starts
+    template<typename matcher>
+    using searcher = std::conditional_t<
+        anchored<matcher>::enabled,
+        anchored<matcher>,
+        std::conditional_t<
+            literal_prefix<matcher>::enabled,
+            literal_prefix<matcher>,
+            std::conditional_t<
+                teddy<matcher>::enabled,
+                teddy<matcher>,
+                std::conditional_t<
+                    class_scan<matcher>::enabled,
+                    class_scan<matcher>,
+                    std::conditional_t<
+                        bndm<matcher>::enabled,
+                        bndm<matcher>,
+                        std::conditional_t<
+                            shift_and<matcher>::enabled,
+                            shift_and<matcher>,
+                            std::conditional_t<
+                                required_literal<matcher>::enabled,
+                                required_literal<matcher>,
+                                std::conditional_t<bigram<matcher>::enabled,
+                                                   bigram<matcher>,
+                                                   first_byte<matcher>>>>>>>>>;
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_SEARCHER_HPP_*/
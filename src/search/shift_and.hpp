@@ -0,0 +1,182 @@
+#ifndef E_REGEX_SEARCH_SHIFT_AND_HPP_
+#define E_REGEX_SEARCH_SHIFT_AND_HPP_
+
+#include <array>
+#include <cstdint>
+
+#include "analysis/class_sequence.hpp"
+#include "first_byte.hpp"
+
+namespace e_regex::search
+{
+    namespace __private
+    {
+        struct shift_and_masks
+        {
+                // Bit i of masks[c] is set if position i admits c
+                std::array<std::uint64_t, 256> masks = {};
+
+                // Optional positions, the position before each block
+                // of them and the last one of each block
+                std::uint64_t optional     = 0;
+                std::uint64_t block_before = 0;
+                std::uint64_t block_last   = 0;
+
+                // Blocks of optional positions at the start are always
+                // skippable
+                std::uint64_t leading = 0;
+
+                std::uint64_t accept = 0;
+        };
+
+        template<typename matcher>
+        constexpr auto make_shift_and_masks() noexcept -> shift_and_masks
+        {
+            constexpr auto& sequence = analysis::class_sequence_v<matcher>;
+
+            shift_and_masks result;
+            result.optional = sequence.optional;
+            result.accept   = std::uint64_t {1} << (sequence.size - 1);
+
+            for (unsigned i = 0; i < sequence.size; ++i)
+            {
+                const auto bit = std::uint64_t {1} << i;
+
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    if (sequence.bytes[i].contains(c))
+                    {
+                        result.masks[c] |= bit;
+                    }
+                }
+
+                if ((sequence.optional & bit) == 0)
+                {
+                    continue;
+                }
+
+                if (i == 0 || (result.leading & (bit >> 1)) != 0)
+                {
+                    result.leading |= bit;
+                }
+                else if ((sequence.optional & (bit >> 1)) == 0)
+                {
+                    result.block_before |= bit >> 1;
+                }
+
+                if (i + 1 == sequence.size
+                    || (sequence.optional & (bit << 1)) == 0)
+                {
+                    result.block_last |= bit;
+                }
+            }
+
+            return result;
+        }
+    } // namespace __private
+
+    /*
+     * The regex is a short sequence of byte sets, some optional:
+     * Shift-And simulates all the attempts at once, a bit per
+     * position. Optional blocks are filled by a subtraction, as in
+     * Navarro and Raffinot's extended Shift-And, so each byte costs
+     * the same few operations. The earliest match end bounds where the
+     * leftmost match can start.
+     */
+    template<typename matcher>
+    struct shift_and
+    {
+            static constexpr auto& sequence
+                = analysis::class_sequence_v<matcher>;
+
+            // A single position is better served by first_byte
+            static constexpr bool enabled = sequence.valid
+                                            && sequence.size > 1
+                                            && sequence.minimum() > 0;
+
+            struct state
+            {
+                    // Earliest match end found by the last scan
+                    const char* match_end = nullptr;
+            };
+
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin, const char* end, state& state) noexcept
+                -> const char*
+            {
+                if (state.match_end == nullptr
+                    || state.match_end - begin < minimum)
+                {
+                    state.match_end = scan(begin, end);
+
+                    if (state.match_end == nullptr)
+                    {
+                        return end;
+                    }
+                }
+
+                // Earlier starts would have ended earlier
+                return state.match_end - begin > maximum
+                           ? state.match_end - maximum
+                           : begin;
+            }
+
+        private:
+            static constexpr long minimum = sequence.minimum();
+            static constexpr long maximum = sequence.size;
+
+            static constexpr auto masks = [] {
+                if constexpr (enabled)
+                {
+                    return __private::make_shift_and_masks<matcher>();
+                }
+                else
+                {
+                    return __private::shift_and_masks {};
+                }
+            }();
+
+            // End of the first match in [begin, end), nullptr if none
+            static constexpr __attribute__((always_inline)) auto
+                scan(const char* begin, const char* end) noexcept
+                -> const char*
+            {
+                auto active = masks.leading;
+
+                for (const auto* current = begin; current < end;)
+                {
+                    if (active == masks.leading)
+                    {
+                        // Only a new attempt can make progress
+                        current = first_byte<matcher>::find(current, end);
+
+                        if (current >= end)
+                        {
+                            break;
+                        }
+                    }
+
+                    const auto c = static_cast<unsigned char>(*current);
+                    ++current;
+
+                    active = ((active << 1U) | 1U) & masks.masks[c];
+
+                    // Each block of optional positions is entered from
+                    // the position before it, or from any of its own
+                    // positions, and can be left at any point
+                    const auto filled = active | masks.block_last;
+                    active |= masks.optional
+                              & (~(filled - masks.block_before) ^ filled);
+
+                    if ((active & masks.accept) != 0)
+                    {
+                        return current;
+                    }
+                }
+
+                return nullptr;
+            }
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_SHIFT_AND_HPP_*/
@@ -0,0 +1,104 @@
+#ifndef E_REGEX_SEARCH_SUBSTRING_HPP_
+#define E_REGEX_SEARCH_SUBSTRING_HPP_
+
+#include <bit>
+#include <type_traits>
+
+#include "byte_scan.hpp"
+#include "horspool.hpp"
+#include "utilities/byte_set.hpp"
+
+namespace e_regex::search
+{
+    namespace __private
+    {
+        template<char c>
+        inline constexpr auto single_byte = [] {
+            byte_set result;
+            result.insert(static_cast<unsigned char>(c));
+
+            return result;
+        }();
+
+        // True if the bytes of needle between the first and the last
+        // one follow candidate
+        template<const auto& needle>
+        constexpr __attribute__((always_inline)) auto
+            matches_middle(const char* candidate) noexcept -> bool
+        {
+            for (unsigned i = 1; i + 1 < needle.size; ++i)
+            {
+                if (candidate[i] != needle.chars[i])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    } // namespace __private
+
+    /**
+     * @brief Finds the first occurrence of needle in [begin, end)
+     *
+     * Candidates are found comparing the first and the last byte of
+     * the needle 16 positions at a time, then verified. The tail of
+     * the input and constant evaluation use Horspool.
+     *
+     * @return end if there is none
+     */
+    template<const auto& needle>
+    constexpr auto find_substring(const char* begin,
+                                  const char* end) noexcept -> const char*
+    {
+        using namespace __private;
+
+        if constexpr (needle.size == 1)
+        {
+            return find_first_of<single_byte<needle.chars[0]>>(begin, end);
+        }
+        else
+        {
+            if (end - begin < static_cast<long>(needle.size))
+            {
+                return end;
+            }
+
+            // Last position where the needle fits
+            const auto* last = end - needle.size;
+
+            if (!std::is_constant_evaluated())
+            {
+                constexpr auto head = static_cast<unsigned char>(needle.chars[0]);
+                constexpr auto tail = static_cast<unsigned char>(
+                    needle.chars[needle.size - 1]);
+
+                while (last - begin >= static_cast<long>(vector_size))
+                {
+                    auto bits = mask_bits(std::bit_cast<vector>(
+                        (load(begin) == splat(head))
+                        & (load(begin + needle.size - 1) == splat(tail))));
+
+                    while (bits != 0)
+                    {
+                        const auto* candidate
+                            = begin + std::countr_zero(bits);
+
+                        if (matches_middle<needle>(candidate))
+                        {
+                            return candidate;
+                        }
+
+                        bits &= bits - 1;
+                    }
+
+                    begin += vector_size;
+                }
+            }
+
+            return find_horspool<needle>(begin, end);
+        }
+    }
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_SUBSTRING_HPP_*/
@@ -0,0 +1,174 @@
+#ifndef E_REGEX_SEARCH_TEDDY_HPP_
+#define E_REGEX_SEARCH_TEDDY_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#include "analysis/leading_literals.hpp"
+#include "byte_scan.hpp"
+
+namespace e_regex::search
+{
+    namespace __private
+    {
+        // Literals are spread over the 8 bits of a lane
+        inline constexpr auto teddy_buckets = 8U;
+
+        // Bytes of each literal looked up in the vector scan
+        inline constexpr auto max_teddy_masks = 3U;
+    } // namespace __private
+
+    /*
+     * Every match starts with one of a few literals: candidates for
+     * all of them are found at once, Teddy style. Each literal owns a
+     * bit of a bucket mask; the low and the high nibble of each of
+     * the first bytes select the buckets admitting it, and a lane
+     * whose masks intersect starts a candidate, verified against the
+     * literals of its buckets.
+     */
+    template<typename matcher>
+    struct teddy
+    {
+            static constexpr auto literals
+                = analysis::leading_literals_v<matcher>;
+
+            static constexpr auto masks
+                = std::min(literals.shortest(), __private::max_teddy_masks);
+
+            // A single literal is left to literal_prefix, and a single
+            // byte to first_byte
+            static constexpr bool enabled = __private::has_shuffle
+                                            && literals.valid
+                                            && literals.size > 1
+                                            && masks > 1;
+
+            struct state
+            {};
+
+        private:
+            using nibbles = std::array<std::uint8_t, 16>;
+
+            // Buckets admitting each nibble of byte k of a candidate
+            static constexpr auto tables = [] {
+                struct
+                {
+                        std::array<nibbles, masks> low  = {};
+                        std::array<nibbles, masks> high = {};
+                } result;
+
+                for (unsigned i = 0; i < literals.size; ++i)
+                {
+                    const auto bucket = 1U << (i % __private::teddy_buckets);
+
+                    for (unsigned k = 0; k < masks; ++k)
+                    {
+                        const auto c = static_cast<unsigned char>(
+                            literals.literals[i].chars[k]);
+
+                        result.low[k][c & 15U] |= bucket;
+                        result.high[k][c >> 4U] |= bucket;
+                    }
+                }
+
+                return result;
+            }();
+
+            // Checks the literals of buckets against [candidate, end)
+            static constexpr __attribute__((always_inline)) auto
+                verify(const char* candidate,
+                       const char* end,
+                       unsigned    buckets) noexcept -> bool
+            {
+                for (unsigned i = 0; i < literals.size; ++i)
+                {
+                    const auto& literal = literals.literals[i];
+
+                    if (((buckets >> (i % __private::teddy_buckets)) & 1U)
+                            == 0
+                        || end - candidate < static_cast<long>(literal.size))
+                    {
+                        continue;
+                    }
+
+                    if (std::equal(literal.chars.begin(),
+                                   literal.chars.begin() + literal.size,
+                                   candidate))
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+        public:
+            static constexpr __attribute__((always_inline)) auto
+                find(const char* begin,
+                     const char* end,
+                     state& /*state*/) noexcept -> const char*
+            {
+#if defined(__SSSE3__)
+                using namespace __private;
+
+                if (!std::is_constant_evaluated())
+                {
+                    std::array<vector, masks> low;
+                    std::array<vector, masks> high;
+
+                    for (unsigned k = 0; k < masks; ++k)
+                    {
+                        low[k]  = std::bit_cast<vector>(tables.low[k]);
+                        high[k] = std::bit_cast<vector>(tables.high[k]);
+                    }
+
+                    // Lane i of the last load reads byte i + masks - 1
+                    while (end - begin
+                           >= static_cast<long>(vector_size + masks - 1))
+                    {
+                        auto candidates = ~vector {};
+
+                        for (unsigned k = 0; k < masks; ++k)
+                        {
+                            const auto data = load(begin + k);
+
+                            candidates &= shuffle(low[k], data)
+                                          & shuffle(high[k], data >> 4);
+                        }
+
+                        auto bits = mask_bits(
+                            std::bit_cast<vector>(candidates != vector {}));
+
+                        while (bits != 0)
+                        {
+                            const auto lane = std::countr_zero(bits);
+
+                            if (verify(begin + lane, end, candidates[lane]))
+                            {
+                                return begin + lane;
+                            }
+
+                            bits &= bits - 1;
+                        }
+
+                        begin += vector_size;
+                    }
+                }
+#endif
+
+                for (; begin < end; ++begin)
+                {
+                    if (verify(begin, end, ~0U))
+                    {
+                        return begin;
+                    }
+                }
+
+                return end;
+            }
+    };
+} // namespace e_regex::search
+
+#endif /* E_REGEX_SEARCH_TEDDY_HPP_*/
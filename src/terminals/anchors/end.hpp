@@ -10,8 +10,8 @@ namespace e_regex::terminals::anchors
     {
             static constexpr auto expression = static_string {"$"};
 
-            static constexpr auto meta = e_regex::meta<
-                admitted_set_complement_t<admitted_set<char, '\n'>>> {
+            // Only a trailing newline can be consumed
+            static constexpr auto meta = e_regex::meta<admitted_set<char, '\n'>> {
                 .policy_            = e_regex::policy::NONE,
                 .minimum_match_size = 0,
                 .maximum_match_size = 1,
@@ -37,10 +37,7 @@ namespace e_regex::tokenization
 
                 static constexpr auto tokens = std::tuple_cat(
                     std::make_tuple(token_matcher {
-                        token.type,
-                        // Adding ^ to alway match the beginning of
-                        // current
-                        e_regex::regex<static_string {"^"} + token.matcher> {}}),
+                        token.type, e_regex::regex<token.matcher> {}}),
                     rec::tokens);
                 static constexpr auto separators = rec::separators;
         };
@@ -52,8 +49,7 @@ namespace e_regex::tokenization
 
                 static constexpr auto tokens     = rec::tokens;
                 static constexpr auto separators = std::tuple_cat(
-                    std::make_tuple(
-                        e_regex::regex<static_string {"^"} + token.matcher> {}),
+                    std::make_tuple(e_regex::regex<token.matcher> {}),
                     rec::separators);
         };
 
@@ -102,7 +98,8 @@ namespace e_regex::tokenization
             {
                 auto matches = std::apply(
                     [this](auto... regex) {
-                        return std::array {regex(current).to_view()...};
+                        return std::array {
+                            regex.match_prefix(current).to_view()...};
                     },
                     data::separators);
 
@@ -129,7 +126,8 @@ namespace e_regex::tokenization
                 auto matches = std::apply(
                     [this](auto... token) {
                         return std::array {token_t {
-                            .value = token.matcher(current).to_view(),
+                            .value
+                            = token.matcher.match_prefix(current).to_view(),
                             .type  = token.type}...};
                     },
                     data::tokens);
@@ -0,0 +1,144 @@
+#ifndef E_REGEX_UTILITIES_BYTE_SET_HPP_
+#define E_REGEX_UTILITIES_BYTE_SET_HPP_
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace e_regex
+{
+    // Runtime counterpart of admitted_set: a 256-bit set of bytes
+    struct byte_set
+    {
+            std::array<std::uint64_t, 4> bits = {};
+
+            template<typename set>
+            static constexpr auto from_admitted_set() -> byte_set
+            {
+                byte_set result;
+
+                for (const auto c: set::chars)
+                {
+                    result.insert(static_cast<unsigned char>(c));
+                }
+
+                return result;
+            }
+
+            constexpr void insert(unsigned char c) noexcept
+            {
+                bits[c >> 6U] |= std::uint64_t {1} << (c & 63U);
+            }
+
+            constexpr void insert_range(unsigned char first,
+                                        unsigned char last) noexcept
+            {
+                for (unsigned c = first; c <= last; ++c)
+                {
+                    insert(static_cast<unsigned char>(c));
+                }
+            }
+
+            constexpr __attribute__((always_inline)) auto
+                contains(unsigned char c) const noexcept -> bool
+            {
+                return ((bits[c >> 6U] >> (c & 63U)) & 1U) != 0;
+            }
+
+            constexpr auto size() const noexcept -> unsigned
+            {
+                unsigned result = 0;
+
+                for (const auto word: bits)
+                {
+                    result += std::popcount(word);
+                }
+
+                return result;
+            }
+
+            constexpr auto empty() const noexcept -> bool
+            {
+                return size() == 0;
+            }
+
+            constexpr auto full() const noexcept -> bool
+            {
+                return size() == 256;
+            }
+
+            // Number of maximal runs of contiguous bytes
+            constexpr auto ranges() const noexcept -> unsigned
+            {
+                unsigned result = 0;
+
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    if (contains(c) && (c == 0 || !contains(c - 1)))
+                    {
+                        ++result;
+                    }
+                }
+
+                return result;
+            }
+
+            // The n-th byte of the set, in ascending order
+            constexpr auto at(unsigned n) const noexcept -> unsigned char
+            {
+                for (unsigned c = 0; c < 256; ++c)
+                {
+                    if (contains(c) && n-- == 0)
+                    {
+                        return static_cast<unsigned char>(c);
+                    }
+                }
+
+                return 0;
+            }
+
+            constexpr auto operator|(const byte_set& other) const noexcept
+                -> byte_set
+            {
+                byte_set result;
+
+                for (unsigned i = 0; i < bits.size(); ++i)
+                {
+                    result.bits[i] = bits[i] | other.bits[i];
+                }
+
+                return result;
+            }
+
+            constexpr auto operator&(const byte_set& other) const noexcept
+                -> byte_set
+            {
+                byte_set result;
+
+                for (unsigned i = 0; i < bits.size(); ++i)
+                {
+                    result.bits[i] = bits[i] & other.bits[i];
+                }
+
+                return result;
+            }
+
+            constexpr auto operator~() const noexcept -> byte_set
+            {
+                byte_set result;
+
+                for (unsigned i = 0; i < bits.size(); ++i)
+                {
+                    result.bits[i] = ~bits[i];
+                }
+
+                return result;
+            }
+
+            constexpr auto operator==(const byte_set& other) const noexcept
+                -> bool
+                = default;
+    };
+} // namespace e_regex
+
+#endif /* E_REGEX_UTILITIES_BYTE_SET_HPP_*/
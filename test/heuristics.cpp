@@ -1,9 +1,22 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <tuple>
 #include <type_traits>
 
+#include "analysis/class_sequence.hpp"
+#include "analysis/leading_literals.hpp"
+#include "analysis/leading_run.hpp"
+#include "analysis/leftmost_first.hpp"
+#include "analysis/literal.hpp"
+#include "analysis/memo_sites.hpp"
+#include "analysis/prefix_shifts.hpp"
+#include "automata/aho_corasick.hpp"
+#include "automata/byte_classes.hpp"
+#include "automata/dfa.hpp"
+#include "automata/one_pass.hpp"
 #include "e_regex.hpp"
 #include "nodes.hpp"
+#include "search/bigram.hpp"
 #include "terminals/exact_matcher.hpp"
 #include "tokenizer.hpp"
 #include "utilities/admitted_set.hpp"
@@ -33,6 +46,20 @@ TEST_CASE("Admission set of a node")
                        e_regex::admitted_set<char, 'a', 'b', 'c', 'd', 'z'>>);
 }
 
+TEST_CASE("Admission set of a branched node")
+{
+    using matcher = typename e_regex::regex<R"(x|yz)">::ast;
+
+    // Every branch can start a match
+    REQUIRE(std::is_same_v<typename decltype(matcher::meta)::admission_set,
+                           e_regex::admitted_set<char, 'x', 'y'>>);
+
+    using matcher1 = typename e_regex::regex<R"([^x])">::ast;
+
+    REQUIRE(decltype(matcher1::meta)::admission_set::can_admit('\xC3'));
+    REQUIRE(!decltype(matcher1::meta)::admission_set::can_admit('x'));
+}
+
 TEST_CASE("Admission set intersection")
 {
     using matcher  = typename e_regex::regex<R"(\d+)">::ast;
@@ -49,3 +76,283 @@ TEST_CASE("Greedy backtracking removal")
 
     REQUIRE(matcher::expression.to_view() == R"([0-9]++\s++123)");
 }
+
+TEST_CASE("Required literal extraction")
+{
+    using matcher = typename e_regex::regex<R"([\w.\-]+@[\w\-]+\.[\w.]+)">::ast;
+
+    constexpr auto summary = e_regex::analysis::literal_summary_v<matcher>;
+
+    REQUIRE(std::string_view {summary.required.chars.data(),
+                              summary.required.size}
+            == "@");
+    REQUIRE(summary.required_minimum_offset == 1);
+    REQUIRE(summary.required_maximum_offset == e_regex::analysis::unbounded);
+
+    using matcher1 = typename e_regex::regex<R"(\w+://[^\s]+)">::ast;
+
+    constexpr auto summary1 = e_regex::analysis::literal_summary_v<matcher1>;
+
+    REQUIRE(std::string_view {summary1.required.chars.data(),
+                              summary1.required.size}
+            == "://");
+
+    using matcher2 = typename e_regex::regex<R"((ab){2}c)">::ast;
+
+    constexpr auto summary2 = e_regex::analysis::literal_summary_v<matcher2>;
+
+    REQUIRE(summary2.exact);
+    REQUIRE(std::string_view {summary2.prefix.chars.data(),
+                              summary2.prefix.size}
+            == "ababc");
+}
+
+TEST_CASE("Leading literals extraction")
+{
+    using matcher = typename e_regex::regex<"ERROR|WARN|FATAL|panic:">::ast;
+
+    constexpr auto literals = e_regex::analysis::leading_literals_v<matcher>;
+
+    REQUIRE(literals.valid);
+    REQUIRE(literals.size == 4);
+    REQUIRE(literals.shortest() == 4);
+
+    using matcher1 =
+        typename e_regex::regex<R"((?:GET|POST|PUT) /\w*)">::ast;
+
+    constexpr auto literals1
+        = e_regex::analysis::leading_literals_v<matcher1>;
+
+    REQUIRE(literals1.valid);
+    REQUIRE(literals1.size == 3);
+
+    // A branch can start with any byte
+    using matcher2 = typename e_regex::regex<R"(ab|\w+c)">::ast;
+
+    REQUIRE(!e_regex::analysis::leading_literals_v<matcher2>.valid);
+}
+
+TEST_CASE("Class sequence extraction")
+{
+    using matcher = typename e_regex::regex<R"((\d{4})-\d\d?-[A-Z]{0,2})">::ast;
+
+    constexpr auto sequence = e_regex::analysis::class_sequence_v<matcher>;
+
+    REQUIRE(sequence.valid);
+    REQUIRE(sequence.size == 10);
+    REQUIRE(sequence.minimum() == 7);
+    REQUIRE(sequence.optional == 0b1101000000);
+    REQUIRE(sequence.bytes[4].contains('-'));
+    REQUIRE(!sequence.bytes[4].contains('0'));
+
+    // Alternations of single bytes are one position
+    using matcher1 = typename e_regex::regex<"(?:x|y)[ab]">::ast;
+
+    constexpr auto sequence1 = e_regex::analysis::class_sequence_v<matcher1>;
+    REQUIRE(sequence1.valid);
+    REQUIRE(sequence1.size == 2);
+    REQUIRE(sequence1.bytes[0].contains('y'));
+
+    using matcher2 = typename e_regex::regex<R"(\d+-\d)">::ast;
+    REQUIRE(!e_regex::analysis::class_sequence_v<matcher2>.valid);
+
+    // Optional copies of more than one position
+    using matcher3 = typename e_regex::regex<R"(a(?:bc)?d)">::ast;
+    REQUIRE(!e_regex::analysis::class_sequence_v<matcher3>.valid);
+}
+
+TEST_CASE("Leading run detection")
+{
+    using e_regex::analysis::leading_run;
+
+    // The optimizer makes the loop possessive, '@' cannot continue it
+    constexpr auto& run
+        = leading_run<e_regex::regex<R"([\w.\-]+@[\w\-]+\.[\w.]+)">::ast>;
+    REQUIRE(run.contains('.'));
+    REQUIRE(run.contains('z'));
+    REQUIRE(!run.contains('@'));
+
+    static_assert(
+        !leading_run<e_regex::regex<R"(([\d]+)-)">::ast>.empty());
+
+    // Loops that can give bytes back, or bounded ones
+    static_assert(leading_run<e_regex::regex<R"(\w+\d)">::ast>.empty());
+    static_assert(leading_run<e_regex::regex<R"(\w{1,3}@)">::ast>.empty());
+    static_assert(leading_run<e_regex::regex<"a+b|c">::ast>.empty());
+}
+
+TEST_CASE("Prefix shifts")
+{
+    using e_regex::analysis::prefix_shifts_v;
+
+    constexpr auto& shifts
+        = prefix_shifts_v<e_regex::regex<R"(ababc\d+)">::ast>;
+
+    REQUIRE(shifts.prefix.size == 5);
+    REQUIRE(shifts.shift[0] == 1);
+    REQUIRE(shifts.shift[1] == 1);
+    REQUIRE(shifts.shift[3] == 2);
+    REQUIRE(shifts.shift[4] == 2);
+    REQUIRE(shifts.shift[5] == 5);
+
+    constexpr auto& shifts1 = prefix_shifts_v<e_regex::regex<"aa+b">::ast>;
+
+    REQUIRE(shifts1.prefix.size == 2);
+    REQUIRE(shifts1.shift[2] == 1);
+
+    static_assert(
+        prefix_shifts_v<e_regex::regex<R"(\w+@)">::ast>.prefix.size == 0);
+}
+
+TEST_CASE("Byte pair filter")
+{
+    using e_regex::search::bigram;
+
+    using matcher = e_regex::regex<R"([a-z]\d+)">::ast;
+    static_assert(bigram<matcher>::enabled);
+
+    typename bigram<matcher>::state state {};
+    constexpr std::string_view      text = "a word, then x1";
+
+    const auto* end = text.data() + text.size();
+    REQUIRE(bigram<matcher>::find(text.data(), end, state) == end - 2);
+
+    // Nearly any byte can follow the first one
+    static_assert(!bigram<e_regex::regex<R"([a-z]\d*)">::ast>::enabled);
+    static_assert(!bigram<e_regex::regex<R"([a-z]\S+)">::ast>::enabled);
+}
+
+TEST_CASE("Leftmost-first detection")
+{
+    using e_regex::analysis::matches_leftmost_first;
+
+    REQUIRE(matches_leftmost_first<
+            typename e_regex::regex<R"([\w.\-]+@[\w\-]+\.[\w.]+)">::ast>);
+    REQUIRE(matches_leftmost_first<typename e_regex::regex<"aaa|a+">::ast>);
+
+    // Committed alternations whose branches overlap
+    REQUIRE(!matches_leftmost_first<
+            typename e_regex::regex<"(?:ab|a)c">::ast>);
+
+    // Groups and anchors are left to the backtracker
+    REQUIRE(!matches_leftmost_first<typename e_regex::regex<"(a)b">::ast>);
+    REQUIRE(!matches_leftmost_first<typename e_regex::regex<"^ab">::ast>);
+
+    using e_regex::analysis::captures_leftmost_first;
+
+    REQUIRE(captures_leftmost_first<typename e_regex::regex<"(a)b">::ast>);
+    REQUIRE(captures_leftmost_first<
+            typename e_regex::regex<R"(.*(\d+)-)">::ast>);
+
+    // The head of a group is committed
+    REQUIRE(!captures_leftmost_first<
+            typename e_regex::regex<R"((\w+)(\d))">::ast>);
+}
+
+TEST_CASE("Byte classes")
+{
+    using matcher = typename e_regex::regex<
+        R"([\w.\-]+@[\w\-]+\.[\w.]+)">::ast;
+
+    constexpr auto& classes = e_regex::automata::class_map<matcher>;
+
+    // Words, '.', '-', '@' and every other byte
+    REQUIRE(classes.count == 5);
+    REQUIRE(classes.class_of['a'] == classes.class_of['7']);
+    REQUIRE(classes.class_of['a'] != classes.class_of['.']);
+    REQUIRE(classes.class_of[' '] == classes.class_of[0xFF]);
+    REQUIRE(classes.class_of[' '] == classes.class_of['#']);
+
+    // Overlapping sets split each other
+    using matcher1 = typename e_regex::regex<"[a-f]+[d-z]">::ast;
+
+    REQUIRE(e_regex::automata::class_map<matcher1>.count == 4);
+}
+
+TEST_CASE("Aho-Corasick automaton")
+{
+    using matcher = typename e_regex::regex<"abcd|bc|abc|b">::ast;
+    using automaton = e_regex::automata::aho_corasick<matcher>;
+
+    static_assert(automaton::enabled);
+    static_assert(automaton::keywords == 4);
+
+    constexpr auto find = [](std::string_view query) {
+        typename e_regex::search::searcher<matcher>::state state {};
+
+        const char* begin   = nullptr;
+        const char* end     = nullptr;
+        unsigned    keyword = 0;
+
+        const auto found = automaton::find(
+            query.begin(), query.end(), state, begin, end, keyword);
+
+        return std::tuple {found, begin - query.begin(), end - begin, keyword};
+    };
+
+    // Leftmost match, first branch among those starting there
+    REQUIRE(find("xabce") == std::tuple {true, 1, 3, 2U});
+    REQUIRE(find("xabcd") == std::tuple {true, 1, 4, 0U});
+    REQUIRE(find("xxbc") == std::tuple {true, 2, 2, 1U});
+    REQUIRE(!std::get<0>(find("xxacd")));
+
+    using matcher1 = typename e_regex::regex<R"(ab|\w+c)">::ast;
+    static_assert(!e_regex::automata::aho_corasick<matcher1>::enabled);
+}
+
+TEST_CASE("One-pass detection")
+{
+    using e_regex::automata::one_pass;
+
+    static_assert(
+        one_pass<e_regex::regex<R"((\d+)-(\d+)-(\d+))">::ast>::enabled);
+    static_assert(one_pass<e_regex::regex<R"(((ab|b)-)*1)">::ast>::enabled);
+
+    // Two positions can read the same byte
+    static_assert(!one_pass<e_regex::regex<"(a|ab)c">::ast>::enabled);
+    static_assert(!one_pass<e_regex::regex<R"((\w+)(\d))">::ast>::enabled);
+    static_assert(!one_pass<e_regex::regex<R"(^(\d+))">::ast>::enabled);
+}
+
+TEST_CASE("Unique suffix detection")
+{
+    using e_regex::automata::dfa;
+
+    using matcher = dfa<e_regex::regex<R"([\w.\-]+@example\.com)">::ast>;
+
+    REQUIRE(std::string_view {matcher::suffix.chars.data(),
+                              matcher::suffix.size}
+            == "@example.com");
+    static_assert(matcher::reverse_suffix);
+
+    // The class reads 'b', the suffix starts after it
+    using matcher1 = dfa<e_regex::regex<"[ab]+-b">::ast>;
+
+    REQUIRE(std::string_view {matcher1::suffix.chars.data(),
+                              matcher1::suffix.size}
+            == "-b");
+
+    // No single literal ends every match
+    static_assert(dfa<e_regex::regex<"a+b|c">::ast>::suffix.size == 0);
+
+    // The prefix already leads the search
+    static_assert(!dfa<e_regex::regex<R"(ab\d+-)">::ast>::reverse_suffix);
+}
+
+TEST_CASE("Memo sites")
+{
+    using e_regex::analysis::memo_sites_t;
+
+    // One per repetition that can backtrack into its continuation
+    static_assert(
+        std::tuple_size_v<memo_sites_t<e_regex::regex<"(.*)(.*)b">::ast>>
+        == 2);
+    static_assert(
+        std::tuple_size_v<memo_sites_t<e_regex::regex<"(a?)(a?)(a?)aa">::ast>>
+        == 3);
+
+    // Repetitions made possessive never backtrack
+    static_assert(
+        std::tuple_size_v<memo_sites_t<e_regex::regex<"(a|ab)(b|-)*1">::ast>>
+        == 0);
+}
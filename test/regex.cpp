@@ -1,7 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <e_regex.hpp>
 #include <tokenizer.hpp>
@@ -532,3 +537,734 @@ TEST_CASE("Intersection")
     REQUIRE(!matcher.is_independent(matcher2));
     REQUIRE(!matcher1.is_independent(matcher2));
 }
+
+TEST_CASE("First byte prefilter")
+{
+    constexpr e_regex::regex<R"([xyz]\d)"> matcher;
+
+    constexpr auto match = matcher("abcdefghijklmnopqrstuvwxyz1");
+    REQUIRE(match.is_accepted());
+    REQUIRE(match[0] == "z1");
+
+    constexpr e_regex::regex<R"((?:a|b)+b)"> matcher1;
+    REQUIRE(matcher1("cccabb").to_view() == "abb");
+
+    constexpr e_regex::regex<R"([^a]b)"> matcher2;
+    REQUIRE(matcher2("ab\xC3" "b").to_view() == "\xC3" "b");
+
+    constexpr e_regex::regex<R"([\w.\-]+@)"> matcher3;
+
+    std::string_view test = "a list, of words: with no ats at all - "
+                            "until the very end of the line, mail@";
+    auto counter = 0;
+    for (auto match: matcher3(test))
+    {
+        REQUIRE(match == "mail@");
+        ++counter;
+    }
+
+    REQUIRE(counter == 1);
+
+    // Too many ranges for comparisons, looked up in nibble tables
+    constexpr e_regex::regex<R"([13579BDFHJLNPRTVXZ]\d)"> matcher4;
+
+    const auto match4 = matcher4("aaaa cccc eeee gggg iiii 0A2C4E6G8I Z9");
+    REQUIRE(match4.to_view() == "Z9");
+}
+
+TEST_CASE("Required literal search")
+{
+    constexpr e_regex::regex<R"(\w+://\w+)"> matcher;
+
+    constexpr auto match = matcher("see: http https://example");
+    REQUIRE(match.is_accepted());
+    REQUIRE(match[0] == "https://example");
+
+    constexpr e_regex::regex<R"([\w.]+@\w+)"> matcher1;
+
+    std::string_view test = "a@b, @c, d.e@f and g@";
+    auto counter = 0;
+    for (auto match: matcher1(test))
+    {
+        REQUIRE((match == "a@b" || match == "d.e@f"));
+        ++counter;
+    }
+
+    REQUIRE(counter == 2);
+}
+
+TEST_CASE("Negated classes")
+{
+    constexpr e_regex::regex<R"(a[^\s]b)"> matcher;
+    REQUIRE(matcher("axb").is_accepted());
+    REQUIRE(!matcher("a b").is_accepted());
+
+    constexpr e_regex::regex<R"(a\Wb)"> matcher1;
+    REQUIRE(matcher1("a b").is_accepted());
+    REQUIRE(!matcher1("axb").is_accepted());
+
+    // A failed branch does not move the next one
+    constexpr e_regex::regex<R"(\sa|b)"> matcher2;
+    REQUIRE(matcher2("xb").to_view() == "b");
+}
+
+TEST_CASE("Literal prefix search")
+{
+    static constexpr auto input = []() {
+        std::array<char, 20000> result {};
+        result.fill('e');
+
+        constexpr std::string_view tail = "needle needle42";
+        std::copy(tail.begin(), tail.end(), result.end() - tail.size());
+
+        return result;
+    }();
+
+    constexpr e_regex::regex<R"(needle\d+)"> matcher;
+
+    // Evaluated at compile time on a long input
+    constexpr auto match
+        = matcher(std::string_view {input.data(), input.size()});
+    REQUIRE(match.is_accepted());
+    REQUIRE(match[0] == "needle42");
+
+    constexpr e_regex::regex<"abcabd"> matcher1;
+    REQUIRE(matcher1("abcabcabd").to_view() == "abcabd");
+    REQUIRE(!matcher1("abcabcab").is_accepted());
+}
+
+TEST_CASE("Multi-literal search")
+{
+    constexpr e_regex::regex<"ERROR|WARN|FATAL|panic:"> matcher;
+
+#if defined(__SSSE3__)
+    static_assert(
+        e_regex::search::teddy<typename decltype(matcher)::ast>::enabled);
+#endif
+
+    constexpr auto match
+        = matcher("an ordinary line, WARM but no FAIL, then panic: ERROR");
+    REQUIRE(match.to_view() == "panic:");
+
+    auto match1 = matcher("EEEEEEEEEEEEEEEEEEEEEEEEEEEEERRORWARN");
+    REQUIRE(match1.to_view() == "ERROR");
+    REQUIRE(match1.next());
+    REQUIRE(match1.to_view() == "WARN");
+    REQUIRE(!match1.next());
+
+    constexpr e_regex::regex<R"((?:GET|POST|PUT) /\w*)"> matcher1;
+
+    REQUIRE(matcher1("PUSH /a, PUTS /b, POST /index").to_view()
+            == "POST /index");
+}
+
+TEST_CASE("Shift-And search")
+{
+    constexpr e_regex::regex<R"((\d{4})-(\d{2})-(\d{2}))"> matcher;
+
+    constexpr auto match
+        = matcher("v1.2-3, 2024-1-05, 12024-01-05 and 2025-12-31");
+    REQUIRE(match[0] == "2024-01-05");
+    REQUIRE(match[1] == "2024");
+
+    auto match1 = matcher("2024-01-05 and 2025-12-31");
+    REQUIRE(match1.next());
+    REQUIRE(match1[3] == "31");
+    REQUIRE(!match1.next());
+
+    // Optional positions
+    constexpr e_regex::regex<R"(([A-Z]{1,3})(\d{2,4}))"> matcher1;
+
+    auto match2 = matcher1("a1 ab12 Z9 XY100 ABCD12345");
+    REQUIRE(match2[0] == "XY100");
+    REQUIRE(match2.next());
+    REQUIRE(match2[0] == "BCD1234");
+    REQUIRE(!match2.next());
+
+    constexpr e_regex::regex<R"(x?(y)z?z)"> matcher2;
+    REQUIRE(matcher2("yyzzxyz")[0] == "yzz");
+}
+
+TEST_CASE("Vectorized class sequence search")
+{
+    using hash = e_regex::regex<"[0-9a-f]{32}">;
+    static_assert(e_regex::search::class_scan<typename hash::ast>::enabled);
+
+    // Blocks of 64 bytes are classified at once, runs of hex digits
+    // shorter than the match are found in them and rejected
+    const auto match = hash::match("cafe 0123456789abcdef0123456789abcde "
+                                   "id=00112233445566778899aabbccddeeff9");
+    REQUIRE(match.to_view() == "00112233445566778899aabbccddeeff");
+
+    constexpr e_regex::regex<
+        R"(([0-9a-f]{8})-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12})">
+        uuid;
+
+    auto match1 = uuid("a-b 12345678-1234-1234-1234-12345678 "
+                       "deadbeef-0000-4000-8000-0123456789ab-ffffffff-0000"
+                       "-4000-8000-0123456789ab");
+    REQUIRE(match1[1] == "deadbeef");
+    REQUIRE(match1.next());
+    REQUIRE(match1[0] == "ffffffff-0000-4000-8000-0123456789ab");
+    REQUIRE(!match1.next());
+
+    // Validation checks the input a vector at a time
+    using timestamp = e_regex::regex<R"(\d{4}-\d{2}-\d{2}T\d{2}:\d{2})">;
+
+    REQUIRE(timestamp::full_match("2024-01-05T12:30"));
+    REQUIRE(!timestamp::full_match("2024-01-05T12:3x"));
+    REQUIRE(!timestamp::full_match("2024-01-05 12:30"));
+    REQUIRE(!timestamp::full_match("2024-01-05T12:300"));
+    static_assert(timestamp::full_match("2024-01-05T12:30"));
+
+    const auto match2 = uuid.full_match("deadbeef-0000-4000-8000-0123456789ab");
+    REQUIRE(match2[1] == "deadbeef");
+}
+
+TEST_CASE("Backward factor search")
+{
+    using e_regex::search::bndm;
+
+    // SHA-256 digests are too wide for the vectorized scan
+    using digest = e_regex::regex<"[0-9a-f]{64}", e_regex::engines::backtracking>;
+    static_assert(bndm<typename digest::ast>::enabled);
+    static_assert(!e_regex::search::class_scan<typename digest::ast>::enabled);
+
+    // Windows ending inside shorter runs of hex digits shift past them
+    const auto query = "cafe " + std::string(63, 'a') + " id="
+                       + std::string(64, 'b') + "9";
+
+    const auto match = digest::match(std::string_view {query});
+    REQUIRE(match.to_view() == std::string(64, 'b'));
+
+    // Short sequences, or ones with optional positions, keep Shift-And
+    static_assert(
+        !bndm<typename e_regex::regex<R"(\d\d)">::ast>::enabled);
+    static_assert(
+        !bndm<typename e_regex::regex<R"([A-Z]{1,8})">::ast>::enabled);
+}
+
+TEST_CASE("Anchored search")
+{
+    constexpr e_regex::regex<R"(^\d+$)"> matcher;
+
+    static constexpr auto input = []() {
+        std::array<char, 20000> result {};
+        result.fill('1');
+        result[1] = 'x';
+
+        return result;
+    }();
+
+    // Only the first position is attempted
+    constexpr auto match
+        = matcher(std::string_view {input.data(), input.size()});
+    REQUIRE(!match.is_accepted());
+    REQUIRE(matcher("123").is_accepted());
+
+    constexpr e_regex::regex<"^a*"> matcher1;
+
+    auto counter = 0;
+    for (auto match: matcher1("aab"))
+    {
+        REQUIRE(match == "aa");
+        ++counter;
+    }
+
+    REQUIRE(counter == 1);
+}
+
+TEST_CASE("Prefix and full match")
+{
+    constexpr e_regex::regex<R"(\d+)"> matcher;
+
+    REQUIRE(matcher.match_prefix("123abc").to_view() == "123");
+    REQUIRE(!matcher.match_prefix("abc123").is_accepted());
+    REQUIRE(matcher("abc123").is_accepted());
+
+    REQUIRE(matcher.full_match("123").is_accepted());
+    REQUIRE(!matcher.full_match("123abc").is_accepted());
+    REQUIRE(!matcher.full_match("abc123").is_accepted());
+
+    constexpr e_regex::regex<R"((\d+)-(\d+))"> matcher1;
+
+    constexpr auto match = matcher1.full_match("12-34");
+    REQUIRE(match.is_accepted());
+    REQUIRE(match[2] == "34");
+
+    // The first branch is a prefix of the second one
+    constexpr e_regex::regex<"a|ab"> matcher2;
+
+    REQUIRE(matcher2.match_prefix("ab").to_view() == "a");
+    REQUIRE(matcher2.full_match("ab").to_view() == "ab");
+    REQUIRE(matcher2.full_match("a").is_accepted());
+    REQUIRE(!matcher2.full_match("abb").is_accepted());
+    static_assert(matcher2.full_match("ab").is_accepted());
+
+    constexpr e_regex::regex<"(a|ab)(c|bcd)"> matcher3;
+
+    const auto match3 = matcher3.full_match("abcd");
+    REQUIRE(match3.is_accepted());
+    REQUIRE(match3[1] == "a");
+    REQUIRE(match3[2] == "bcd");
+}
+
+TEST_CASE("Last match")
+{
+    constexpr e_regex::regex<"/"> matcher;
+
+    constexpr std::string_view path = "/usr/local/bin";
+    REQUIRE(matcher.find_last(path).to_view().data() == path.data() + 10);
+    REQUIRE(!matcher.find_last("bin").is_accepted());
+
+    constexpr e_regex::regex<R"((\d{4})-(\d\d)-(\d\d))"> matcher1;
+
+    constexpr std::string_view log
+        = "2024-01-02 start\n2024-01-03 stop\n2024-01-04 st";
+    const auto last = matcher1.find_last(log);
+    REQUIRE(last[0] == "2024-01-04");
+    REQUIRE(last[3] == "04");
+    REQUIRE(last.to_view().data() == log.data() + 33);
+
+    // The last match, not the match at the last start inside it
+    constexpr e_regex::regex<R"(\d+-)"> matcher2;
+    REQUIRE(matcher2.find_last("1- 22- 3").to_view() == "22-");
+
+    constexpr e_regex::regex<R"(\d+)"> matcher3;
+    REQUIRE(matcher3.find_last("12 345").to_view() == "345");
+    static_assert(matcher3.find_last("12 345").to_view() == "345");
+
+    // Without an automaton, earlier positions are attempted
+    using matcher4 = e_regex::regex<R"((\w+)=)", e_regex::engines::backtracking>;
+    const auto match4 = matcher4::find_last("a=1 key=2 value");
+    REQUIRE(match4[0] == "key=");
+    REQUIRE(match4[1] == "key");
+}
+
+TEST_CASE("Capture-free queries")
+{
+    using matcher = e_regex::regex<R"((\d+)-(\d+))">;
+
+    // Without groups, the compile-time DFA applies
+    static_assert(!e_regex::automata::dfa<matcher::ast>::enabled);
+    static_assert(
+        e_regex::automata::dfa<matcher::capture_free_ast>::enabled);
+    static_assert(e_regex::nodes::group_getter<
+                      matcher::capture_free_ast>::value
+                  == 0);
+
+    static_assert(matcher::contains("ab 12-34"));
+    static_assert(!matcher::contains("12- -34"));
+    static_assert(matcher::count("1-2 3-4 5-") == 2);
+    REQUIRE(matcher::count("") == 0);
+
+    // Children of groups are still tried when backtracking
+    using matcher1 = e_regex::regex<"(a*)ab", e_regex::engines::backtracking>;
+
+    REQUIRE(matcher1::contains("xaab"));
+    REQUIRE(!matcher1::contains("xaa"));
+    REQUIRE(matcher1::count("aab ab aaab") == 3);
+
+    // The search moves on by a byte after an empty match
+    using matcher2 = e_regex::regex<"a*">;
+
+    REQUIRE(matcher2::count("bab") == 3);
+    REQUIRE(e_regex::regex<"x?">::count("xyx") == 3);
+    static_assert(matcher2::count("bab") == 3);
+}
+
+TEST_CASE("Bounds before captures")
+{
+    // The DFA of the regex without groups finds each match
+    constexpr e_regex::regex<R"((\d+)-(\d+))"> matcher;
+
+    constexpr auto match = matcher("id 12-345, 6-7");
+    REQUIRE(match[0] == "12-345");
+    REQUIRE(match[1] == "12");
+    REQUIRE(match[2] == "345");
+
+    auto next = match;
+    REQUIRE(next.next());
+    REQUIRE(next[1] == "6");
+    REQUIRE(next[2] == "7");
+    REQUIRE(!next.next());
+
+    // Alternations of literals keep their groups
+    constexpr e_regex::regex<"(a)(b)|(1)(-)"> matcher1;
+
+    constexpr auto match1 = matcher1("-abaa1");
+    REQUIRE(match1[0] == "ab");
+    REQUIRE(match1[1] == "a");
+    REQUIRE(match1[2] == "b");
+}
+
+TEST_CASE("Deterministic automaton")
+{
+    constexpr e_regex::regex<R"(\d{4}-)"> matcher;
+
+    static_assert(e_regex::automata::dfa<decltype(matcher)::ast>::enabled);
+    REQUIRE(matcher("12345-").to_view() == "2345-");
+
+    // Priorities of the alternation are kept
+    constexpr e_regex::regex<"aaa|a+"> matcher1;
+    REQUIRE(matcher1("baaaa").to_view() == "aaa");
+
+    constexpr e_regex::regex<"a+?b|ac"> matcher2;
+    REQUIRE(matcher2("xaacab").to_view() == "ac");
+
+    constexpr e_regex::regex<R"([\w.\-]+@[\w\-]+\.[\w.]+)"> matcher3;
+
+    constexpr auto match = matcher3("mail: -a.b@c.d.e, x@y");
+    REQUIRE(match.is_accepted());
+    REQUIRE(match[0] == "-a.b@c.d.e");
+    REQUIRE(!matcher3("x@y").is_accepted());
+
+    // Failed attempts do not skip later starts
+    constexpr e_regex::regex<R"(\d[01]?\d)"> matcher4;
+    REQUIRE(matcher4("5a12").to_view() == "12");
+}
+
+TEST_CASE("Deterministic automaton budget")
+{
+    // Too costly to build at compile time, other engines are used
+    constexpr e_regex::regex<"foo|bar|baz|qux|quux|corge|grault|garply|"
+                             "waldo|fred|plugh|xyzzy|thud">
+        matcher;
+
+    static_assert(!e_regex::automata::dfa<decltype(matcher)::ast>::enabled);
+    REQUIRE(matcher("quu corgi xyzzy").to_view() == "xyzzy");
+
+    constexpr e_regex::regex<"[0-9a-f]{64}"> matcher1;
+
+    static_assert(!e_regex::automata::dfa<decltype(matcher1)::ast>::enabled);
+
+    const auto digest = std::string(64, 'c');
+    const auto query  = std::string(63, 'a') + "-" + digest;
+    REQUIRE(matcher1(std::string_view {query}).to_view() == digest);
+
+    // Small automata with many states are still built
+    constexpr e_regex::regex<"(?:a|b)*a(?:a|b){6}"> matcher2;
+
+    static_assert(e_regex::automata::dfa<decltype(matcher2)::ast>::enabled);
+    REQUIRE(matcher2("cabbbbbbb").to_view() == "abbbbbb");
+}
+
+TEST_CASE("Reverse suffix search")
+{
+    constexpr e_regex::regex<R"([\w.\-]+@example\.com)"> matcher;
+
+    constexpr auto match
+        = matcher("to: a@b.org, john.doe@example.com, x@example.co");
+    REQUIRE(match[0] == "john.doe@example.com");
+
+    auto next = match;
+    REQUIRE(!next.next());
+
+    // Occurrences without a valid prefix are skipped
+    REQUIRE(matcher(" @example.com @example.comb@example.com").to_view()
+            == "example.comb@example.com");
+
+    // The leftmost start wins over an earlier suffix
+    constexpr e_regex::regex<"[ab]+-b"> matcher1;
+    REQUIRE(matcher1("-b ab-ba-b").to_view() == "ab-b");
+}
+
+TEST_CASE("Lazy deterministic automaton")
+{
+    using e_regex::engines::lazy_dfa;
+
+    // The compile-time DFA would need 2^21 states
+    e_regex::regex<"(?:a|b)*a(?:a|b){20}", lazy_dfa<>> matcher;
+
+    const auto expected
+        = std::string(30, 'b') + "a" + std::string(20, 'b');
+    const auto query = "cc" + expected + "c";
+
+    auto match = matcher(std::string_view {query});
+    REQUIRE(match.to_view() == expected);
+    REQUIRE(!match.next());
+
+    const auto statistics = matcher.cache_statistics();
+    REQUIRE(statistics.misses > 0);
+    REQUIRE(statistics.hits > 0);
+
+    e_regex::regex<R"([\w.\-]+@[\w\-]+\.[\w.]+)", lazy_dfa<8>> matcher1;
+
+    auto match1 = matcher1("mail: -a.b@c.d.e, x@y.z");
+    REQUIRE(match1[0] == "-a.b@c.d.e");
+    REQUIRE(match1.next());
+    REQUIRE(match1[0] == "x@y.z");
+    REQUIRE(!match1.next());
+
+    // A thrashing cache gives the search back to the regex tree
+    e_regex::regex<"a(?:a|b){8}c", lazy_dfa<3>> matcher2;
+
+    REQUIRE(matcher2("xxabbbbbbbbcaabababab").to_view() == "abbbbbbbbc");
+    REQUIRE(matcher2.cache_statistics().fallbacks > 0);
+
+    // Constant evaluation runs the regex tree
+    constexpr auto match2
+        = e_regex::regex<"a+?b|ac", lazy_dfa<>> {}("xaacab");
+    REQUIRE(match2.to_view() == "ac");
+}
+
+TEST_CASE("Keyword alternation automaton")
+{
+    // Too many trie nodes for the DFA
+    constexpr e_regex::regex<
+        "tracker-example|ads-example-net|metrics-example-org|"
+        "pixel-example-com|beacon-example-io|telemetry-example|"
+        "analytics-example-net|stats-example-org|counter-example-com|"
+        "adserver-example|doubleclick-example|popup-example-net|"
+        "banner-example-org|clicks-example-com|trackme-example|"
+        "spyware-example-net|malware-example-org|phishing-example-com|"
+        "cryptominer-example|fingerprint-example-net">
+        matcher;
+
+    using ast = decltype(matcher)::ast;
+    static_assert(!e_regex::automata::dfa<ast>::enabled);
+    static_assert(e_regex::automata::aho_corasick<ast>::enabled);
+
+    auto match = matcher("GET spyware-example-ne, counter-example-com/x "
+                         "fingerprint-example-net");
+    REQUIRE(match.to_view() == "counter-example-com");
+    REQUIRE(match.next());
+    REQUIRE(match.to_view() == "fingerprint-example-net");
+    REQUIRE(!match.next());
+
+    constexpr auto match1 = matcher("xtrackme-example");
+    REQUIRE(match1.to_view() == "trackme-example");
+}
+
+TEST_CASE("Bit-parallel engine")
+{
+    using e_regex::engines::bit_parallel;
+
+    // Possessive and lazy quantifiers only matter to the regex tree
+    constexpr e_regex::regex<"(a|b)*+c|a+?d", bit_parallel> matcher;
+
+    static_assert(
+        e_regex::automata::bit_nfa<decltype(matcher)::ast>::enabled);
+
+    constexpr auto match = matcher("xxaad");
+    REQUIRE(match[0] == "aad");
+    REQUIRE(!matcher("aaaaaaaaaaaaaaaaaaaaaaaaab").is_accepted());
+
+    auto match1 = matcher("abc d ad");
+    REQUIRE(match1[0] == "abc");
+    REQUIRE(match1[1] == "b");
+    REQUIRE(match1.next());
+    REQUIRE(match1[0] == "ad");
+    REQUIRE(!match1.next());
+
+    // The automaton accepts "aa", the regex tree never does
+    constexpr e_regex::regex<"a++a|aab", bit_parallel> matcher1;
+    REQUIRE(matcher1("aa aab").to_view() == "aab");
+
+    // More positions than a word
+    constexpr e_regex::regex<"(?:[a-z]{3}-){20}\\d", bit_parallel> matcher2;
+
+    std::string query;
+    for (unsigned i = 0; i < 30; ++i)
+    {
+        query += "abc-";
+    }
+
+    REQUIRE(!matcher2(std::string_view {query}).is_accepted());
+
+    query += "7";
+    REQUIRE(matcher2(std::string_view {query}).to_view()
+            == std::string_view {query}.substr(40));
+}
+
+TEST_CASE("One-pass captures")
+{
+    constexpr e_regex::regex<R"((\d+)-(\d+)-(\d+))"> matcher;
+
+    static_assert(
+        e_regex::automata::one_pass<decltype(matcher)::ast>::enabled);
+
+    constexpr auto match = matcher("v1-2, 2023-01-01");
+    auto [string, year, month, day] = match;
+    REQUIRE(string == "2023-01-01");
+    REQUIRE(year == "2023");
+    REQUIRE(day == "01");
+
+    // Groups of a loop keep their last iteration
+    constexpr e_regex::regex<R"(((ab|b)-)+1)"> matcher1;
+
+    auto match1 = matcher1("ab-b-ab-1");
+    REQUIRE(match1[0] == "ab-b-ab-1");
+    REQUIRE(match1[1] == "ab-");
+    REQUIRE(match1[2] == "ab");
+
+    // Groups of failed attempts are not kept
+    constexpr e_regex::regex<"(a)(-1)?a"> matcher2;
+
+    auto match2 = matcher2("a-a-11aa");
+    REQUIRE(match2[0] == "aa");
+    REQUIRE(match2[2].empty());
+
+    // An earlier end is only reachable by backtracking
+    constexpr e_regex::regex<"(a+)(-1a)?"> matcher3;
+
+    static_assert(
+        e_regex::automata::one_pass<decltype(matcher3)::ast>::enabled);
+    REQUIRE(matcher3("aa-1b")[0] == "aa");
+}
+
+TEST_CASE("Leading run skipping")
+{
+    using matcher = e_regex::regex<R"(([\w.\-]+)@(\w+)\.com)",
+                                   e_regex::engines::backtracking>;
+
+    // Each failed attempt skips the run of its loop
+    const auto query = std::string(5000, 'a') + "@ " + std::string(5000, 'b')
+                       + "@c.org x.y@d.com";
+
+    const auto match = matcher::match(std::string_view {query});
+    REQUIRE(match[0] == "x.y@d.com");
+    REQUIRE(match[1] == "x.y");
+
+    // Starts after the run are still attempted
+    constexpr e_regex::regex<"[ab]+-1", e_regex::engines::backtracking>
+        matcher1;
+    REQUIRE(matcher1("ab-ab-1").to_view() == "ab-1");
+}
+
+TEST_CASE("Prefix shift search")
+{
+    using e_regex::engines::backtracking;
+
+    // Partial hits of the prefix overlap the match
+    constexpr e_regex::regex<R"(ababc(\d+))", backtracking> matcher;
+
+    constexpr auto match = matcher("abababcab ababc1 ababc");
+    REQUIRE(match[0] == "ababc1");
+    REQUIRE(match[1] == "1");
+
+    constexpr e_regex::regex<"aab+", backtracking> matcher1;
+    REQUIRE(matcher1("aaaab").to_view() == "aab");
+}
+
+TEST_CASE("Byte pair search")
+{
+    constexpr e_regex::regex<R"(([a-z]+)(\d+))",
+                             e_regex::engines::backtracking>
+        matcher;
+
+    auto match = matcher("set ab, c 1 and x42, y7");
+    REQUIRE(match[0] == "x42");
+    REQUIRE(match[1] == "x");
+    REQUIRE(match[2] == "42");
+    REQUIRE(match.next());
+    REQUIRE(match[0] == "y7");
+
+    // Pairs straddling the end of the input start no match
+    constexpr e_regex::regex<R"([a-z]\d+)"> matcher1;
+    REQUIRE(!matcher1("abc d"));
+    REQUIRE(matcher1("abc d9").to_view() == "d9");
+}
+
+TEST_CASE("Memoized engine")
+{
+    using e_regex::engines::memoized;
+
+    // Polynomial in the query size for the regex tree
+    using matcher = e_regex::regex<"(a*)(a*)(a*)(a*)(a*)b", memoized>;
+
+    const auto query = std::string(200, 'a') + "-ab";
+
+    std::vector<std::uint64_t> scratch(matcher::scratch_size(query.size()));
+
+    auto match = matcher::match(std::string_view {query}, scratch);
+    REQUIRE(match[0] == "ab");
+    REQUIRE(match[1] == "a");
+    REQUIRE(!match.next());
+
+    using matcher1 = e_regex::regex<"(\\w+?)(\\w*?)-(\\d+)", memoized>;
+
+    constexpr auto groups = [] {
+        std::array<std::uint64_t, 4> scratch = {};
+
+        const auto match = matcher1::match("ab-12 x-3", scratch);
+
+        return std::array {match[0], match[1], match[2], match[3]};
+    }();
+    REQUIRE(groups[0] == "ab-12");
+    REQUIRE(groups[1] == "a");
+    REQUIRE(groups[2] == "b");
+    REQUIRE(groups[3] == "12");
+
+    // Positions past the scratch are not remembered
+    std::array<std::uint64_t, 1> small = {};
+
+    auto match2 = matcher1::match(std::string_view {query}, small);
+    REQUIRE(!match2.is_accepted());
+    REQUIRE(matcher1::match_prefix("x-1 y-2", small)[3] == "1");
+}
+
+TEST_CASE("Pike VM engine")
+{
+    using e_regex::engines::pike_vm;
+
+    constexpr e_regex::regex<R"(.*(\d+)-([a-z]+))", pike_vm> matcher;
+
+    static_assert(
+        e_regex::automata::pike_vm<decltype(matcher)::ast>::enabled);
+
+    // The greedy .* leaves a single digit to the group
+    constexpr auto match = matcher("id 12-ab 34-cd");
+    REQUIRE(match[0] == "id 12-ab 34-cd");
+    REQUIRE(match[1] == "4");
+    REQUIRE(match[2] == "cd");
+
+    // Groups in a loop keep their last iteration
+    constexpr e_regex::regex<"(?:([ab])|-)+1", pike_vm> matcher1;
+
+    auto match1 = matcher1("a-b1 x --1 -a-1");
+    REQUIRE(match1[0] == "a-b1");
+    REQUIRE(match1[1] == "b");
+    REQUIRE(match1.next());
+    REQUIRE(match1[0] == "--1");
+    REQUIRE(match1[1].empty());
+    REQUIRE(match1.next());
+    REQUIRE(match1[0] == "-a-1");
+    REQUIRE(match1[1] == "a");
+    REQUIRE(!match1.next());
+
+    REQUIRE(matcher1.match_prefix("a1 b1")[1] == "a");
+    REQUIRE(!matcher1.match_prefix(" a1").is_accepted());
+
+    // The regex tree commits to the first branch, so the automaton
+    // would not find the same match
+    constexpr e_regex::regex<"(a|ab)c", pike_vm> matcher2;
+
+    static_assert(
+        !e_regex::automata::pike_vm<decltype(matcher2)::ast>::enabled);
+    REQUIRE(!matcher2("abc").is_accepted());
+}
+
+TEST_CASE("Step budget")
+{
+    using e_regex::engines::budgeted;
+
+    using matcher = e_regex::regex<"(a*)(a*)(a*)(a*)(a*)b", budgeted<10000>>;
+
+    const auto query = std::string(200, 'a') + "-ab";
+
+    auto match = matcher::match(std::string_view {query});
+    REQUIRE(!match.is_accepted());
+    REQUIRE(match.is_exhausted());
+
+    // Each search gets the whole budget
+    constexpr auto match1 = matcher::match("aab aab");
+    REQUIRE(match1[0] == "aab");
+    REQUIRE(!match1.is_exhausted());
+
+    auto match2 = match1;
+    REQUIRE(match2.next());
+    REQUIRE(match2[0] == "aab");
+    REQUIRE(!match2.next());
+    REQUIRE(!match2.is_exhausted());
+}
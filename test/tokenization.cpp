@@ -38,3 +38,33 @@ TEST_CASE("Classified tokenization")
     REQUIRE(tokens[2].value == "123");
     REQUIRE(tokens[2].type == type::NUMBER);
 }
+
+TEST_CASE("Tokens with alternations")
+{
+    using e_regex::separator;
+    using e_regex::token;
+
+    enum class type
+    {
+        KEYWORD,
+        WORD
+    };
+
+    // Every branch must match at the current position
+    constexpr auto tokenizer
+        = e_regex::tokenization::tokenizer<token {type::KEYWORD, "if|else"},
+                                           token {type::WORD, "[a-z]+"},
+                                           separator {"\\s"}> {};
+
+    std::vector<decltype(*tokenizer(""))> tokens;
+
+    for (auto token: tokenizer("x if else"))
+    {
+        tokens.push_back(token);
+    }
+
+    REQUIRE(tokens.size() == 3);
+    REQUIRE(tokens[0].type == type::WORD);
+    REQUIRE(tokens[1].type == type::KEYWORD);
+    REQUIRE(tokens[2].value == "else");
+}